@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:51:15 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: the table arena with and without transparent huge
+** pages. Reads last_meal of every philosopher in a page-hopping order,
+** the access pattern of a monitor draining its deadline heap, and
+** reports ns per read along with how much of the process is backed by
+** huge pages.
+** usage: bench/arena_scan [philosophers] [passes]
+*/
+
+#include "philosophers.h"
+
+#define DEFAULT_PHILOS 1000000
+#define DEFAULT_PASSES 20
+#define HOP 40503
+
+static long	anon_huge_kib(void)
+{
+	char	buf[4096];
+	char	*line;
+	ssize_t	len;
+	int		fd;
+
+	fd = open("/proc/self/smaps_rollup", O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (-1);
+	buf[len] = '\0';
+	line = strstr(buf, "AnonHugePages:");
+	if (!line)
+		return (-1);
+	return (atol(line + 14));
+}
+
+static double	scan(t_table *table, int n, int passes)
+{
+	t_nsec	start;
+	t_nsec	sum;
+	long	idx;
+	long	i;
+
+	sum = 0;
+	idx = 0;
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < (long)n * passes)
+	{
+		sum += atomic_load_explicit(&table->hot[idx].last_meal,
+				memory_order_relaxed);
+		idx += HOP;
+		if (idx >= n)
+			idx -= n;
+		i++;
+	}
+	if (sum == 42)
+		printf(" ");
+	return ((double)(clock_read(CLK_MONO) - start) / ((double)n * passes));
+}
+
+static void	run(const char *name, t_huge_mode mode, int n, int passes)
+{
+	t_table	*table;
+	int		i;
+
+	table = arena_alloc(n, mode);
+	if (!table)
+		return ;
+	i = 0;
+	while (i < n)
+	{
+		atomic_store(&table->hot[i].last_meal, i);
+		i++;
+	}
+	printf("%-8s %7.2f ns/read   arena %8zu KiB   AnonHugePages %ld KiB\n",
+		name, scan(table, n, passes), table->arena.len / 1024,
+		anon_huge_kib());
+	arena_free(table);
+}
+
+int	main(int argc, char **argv)
+{
+	int	n;
+	int	passes;
+
+	n = DEFAULT_PHILOS;
+	if (argc > 1)
+		n = atoi(argv[1]);
+	passes = DEFAULT_PASSES;
+	if (argc > 2)
+		passes = atoi(argv[2]);
+	if (n <= 0 || passes <= 0 || clock_setup(CLK_MONO))
+		return (1);
+	run("4k", HUGE_OFF, n, passes);
+	run("thp", HUGE_THP, n, passes);
+	return (0);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock_read.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:16:40 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: average cost of one timestamp read for each clock source,
+** and of now_ns() while the --clock-tick service publishes every 100 us.
+** usage: bench/clock_read [reads]
+*/
+
+#include "philosophers.h"
+
+#define DEFAULT_READS 5000000L
+
+static double	measure(long reads)
+{
+	volatile t_nsec	sink;
+	t_nsec			start;
+	long			i;
+
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < reads)
+	{
+		sink = now_ns();
+		i++;
+	}
+	(void)sink;
+	return ((double)(clock_read(CLK_MONO) - start) / reads);
+}
+
+static void	run_source(char *name, t_clock_src src, long reads, long tick)
+{
+	t_nsec	a;
+	t_nsec	b;
+	t_nsec	step;
+
+	if (clock_setup(src) != 0 || clock_tick_start(tick) != 0)
+	{
+		printf("%-8s unavailable\n", name);
+		return ;
+	}
+	a = now_ns();
+	b = a;
+	while (b == a)
+		b = now_ns();
+	step = b - a;
+	printf("%-8s %8.2f ns/read   observed tick %ld ns\n", name,
+		measure(reads), (long)step);
+	clock_tick_stop();
+}
+
+int	main(int argc, char **argv)
+{
+	long	reads;
+
+	reads = DEFAULT_READS;
+	if (argc > 1)
+		reads = atol(argv[1]);
+	if (reads <= 0)
+		return (1);
+	run_source("mono", CLK_MONO, reads, 0);
+	run_source("coarse", CLK_COARSE, reads, 0);
+	run_source("tsc", CLK_TSC, reads, 0);
+	run_source("tick", CLK_MONO, reads, 100);
+	return (0);
+}
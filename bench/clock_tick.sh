@@ -0,0 +1,30 @@
+#!/bin/sh
+# Total CPU of whole runs with and without the --clock-tick service.
+# For every philosopher count and tick it reports the mean wall, user and
+# system time over the repetitions (from bench/rusage) and the runs that
+# ended in a death. Tick 0 is the plain clock read on every now_ns().
+# usage: bench/clock_tick.sh [philo_binary] [repetitions]
+
+BIN=${1:-./philo}
+REPS=${2:-3}
+RUSAGE=$(dirname "$0")/rusage
+LOG=${TMPDIR:-/tmp}/philo_clock_tick.log
+TICKS="0 100 1000"
+
+[ -x "$RUSAGE" ] || { echo "build $RUSAGE first (make bench)" >&2; exit 1; }
+printf "%-6s %-6s %10s %10s %10s %7s\n" "philos" "tick" "wall_ms" \
+	"user_ms" "sys_ms" "deaths"
+for N in 200 2000; do
+	for T in $TICKS; do
+		i=0
+		while [ $i -lt "$REPS" ]; do
+			"$RUSAGE" "$LOG" "$BIN" "$N" 800 200 200 5 --clock-tick="$T"
+			grep -q " died$" "$LOG" && echo died
+			i=$((i + 1))
+		done | awk -v n="$N" -v t="$T" '
+			$1 == "died" { d++; next }
+			{ w += $1; u += $2; s += $3; k++ }
+			END { printf "%-6s %-6s %10.1f %10.1f %10.1f %7d\n",
+				n, t, w / k, u / k, s / k, d }'
+	done
+done
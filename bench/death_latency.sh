@@ -0,0 +1,64 @@
+#!/bin/sh
+# Death-detection latency under load.
+# Runs a scenario that always ends in a death RUNS times with HOGS busy
+# loops competing for the CPU, collects --death-log samples and prints a
+# histogram plus p50/p99/max of the detection latency (monitor sees the
+# deadline passed) and the print latency ("died" line written), both from
+# the true deadline last_meal + time_to_die. Exits 1 when the max print
+# latency exceeds BOUND_MS, so it doubles as the self-test of the 10 ms
+# contract.
+# usage: bench/death_latency.sh [philo_binary] [runs] [hogs] [bound_ms]
+# The scenario can be overridden with DEATH_ARGS (default: 200 400 200 300).
+
+BIN=${1:-./philo}
+RUNS=${2:-50}
+HOGS=${3:-$(($(nproc) * 2))}
+BOUND_MS=${4:-10}
+ARGS=${DEATH_ARGS:-200 400 200 300}
+SAMPLES=${TMPDIR:-/tmp}/philo_death_latency.txt
+
+rm -f "$SAMPLES"
+PIDS=""
+i=0
+while [ $i -lt "$HOGS" ]; do
+	sh -c 'while :; do :; done' &
+	PIDS="$PIDS $!"
+	i=$((i + 1))
+done
+trap 'kill $PIDS 2>/dev/null' EXIT INT TERM
+i=0
+while [ $i -lt "$RUNS" ]; do
+	# shellcheck disable=SC2086
+	"$BIN" $ARGS --death-log="$SAMPLES" > /dev/null
+	i=$((i + 1))
+done
+kill $PIDS 2>/dev/null
+[ -s "$SAMPLES" ] || { echo "no death recorded"; exit 1; }
+
+echo "scenario: $ARGS   runs: $RUNS   hogs: $HOGS   deaths: \
+$(wc -l < "$SAMPLES")"
+for COL in 1 2; do
+	[ $COL -eq 1 ] && NAME=detect || NAME=print
+	cut -d' ' -f$COL "$SAMPLES" | sort -n | awk -v name="$NAME" '
+		{ v[NR] = $1 / 1e6; b = 0; while (b < 6 && v[NR] >= 2 ^ b) b++
+		  h[b]++ }
+		END {
+			p50 = v[int(NR * 0.50 + 0.999)]; p99 = v[int(NR * 0.99 + 0.999)]
+			printf "%-7s p50 %7.3f ms   p99 %7.3f ms   max %7.3f ms\n",
+				name, p50, p99, v[NR]
+			for (b = 0; b <= 6; b++) {
+				lo = (b == 0) ? 0 : 2 ^ (b - 1)
+				label = (b == 6) ? sprintf(">= %d ms", lo) \
+					: sprintf("< %d ms", 2 ^ b)
+				bar = ""; for (j = 0; j < h[b] * 40 / NR; j++) bar = bar "#"
+				printf "  %-9s %5d %s\n", label, h[b], bar
+			}
+		}'
+done
+MAX=$(cut -d' ' -f2 "$SAMPLES" | sort -n | tail -1)
+rm -f "$SAMPLES"
+if [ "$MAX" -gt $((BOUND_MS * 1000000)) ]; then
+	echo "FAIL: a died line came more than $BOUND_MS ms after its deadline"
+	exit 1
+fi
+echo "OK: every died line within $BOUND_MS ms of its deadline"
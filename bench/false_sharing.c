@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   false_sharing.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:43:50 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:44:55 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: false sharing on the per-meal philosopher state. Each
+** writer updates last_meal and meals_eaten of its own philosopher the way
+** philo_eat() does while a monitor thread keeps reading every last_meal.
+** "packed" is the former t_philo layout, "padded" the t_philo_hot split.
+** Cache-line transfers show up as L1D read misses and last-level misses,
+** counted with perf_event_open() when the kernel allows it.
+** usage: bench/false_sharing [writers] [writes_per_writer]
+*/
+
+#include "philosophers.h"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+
+#define DEFAULT_WRITES 2000000L
+
+typedef struct s_packed
+{
+	int				id;
+	pthread_t		thread;
+	pthread_mutex_t	*fork_left;
+	pthread_mutex_t	*fork_right;
+	_Atomic t_nsec	last_meal;
+	t_table			*table;
+	atomic_int		meals_eaten;
+	int				shard;
+}	t_packed;
+
+typedef struct s_bench
+{
+	t_packed	*packed;
+	t_philo_hot	*hot;
+	int			writers;
+	long		writes;
+	atomic_int	stop;
+	atomic_int	next;
+}	t_bench;
+
+/*
+** L1D read misses lead a group with last-level misses, opened before any
+** thread exists and inherited, so every writer and the monitor count.
+** fd[0] is -1 when the kernel does not allow it.
+*/
+static void	perf_open(int *fd)
+{
+	struct perf_event_attr	attr;
+	int						i;
+
+	i = -1;
+	while (++i < 2)
+	{
+		ft_bzero(&attr, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		if (i == 0)
+		{
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = PERF_COUNT_HW_CACHE_L1D
+				| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+				| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			fd[0] = -1;
+		}
+		attr.disabled = (i == 0);
+		attr.inherit = 1;
+		attr.exclude_kernel = 1;
+		fd[i] = syscall(SYS_perf_event_open, &attr, 0, -1, fd[0], 0);
+	}
+}
+
+/*
+** Runs until every writer is joined, then leaves b ready for the next run.
+*/
+static void	*monitor(t_bench *b)
+{
+	volatile t_nsec	sink;
+	int				i;
+
+	while (!atomic_load(&b->stop))
+	{
+		i = -1;
+		while (++i < b->writers)
+		{
+			if (b->packed)
+				sink = atomic_load(&b->packed[i].last_meal);
+			else
+				sink = atomic_load(&b->hot[i].last_meal);
+		}
+	}
+	(void)sink;
+	atomic_store(&b->next, 0);
+	atomic_store(&b->stop, 0);
+	return (NULL);
+}
+
+/*
+** The first thread to start is the monitor, the others write one
+** philosopher each.
+*/
+static void	*runner(void *arg)
+{
+	t_bench			*b;
+	_Atomic t_nsec	*last_meal;
+	atomic_int		*meals;
+	long			i;
+
+	b = (t_bench *)arg;
+	i = atomic_fetch_add(&b->next, 1);
+	if (i == 0)
+		return (monitor(b));
+	last_meal = &b->hot[i - 1].last_meal;
+	meals = &b->hot[i - 1].meals_eaten;
+	if (b->packed)
+	{
+		last_meal = &b->packed[i - 1].last_meal;
+		meals = &b->packed[i - 1].meals_eaten;
+	}
+	i = 0;
+	while (++i <= b->writes)
+	{
+		atomic_store_explicit(last_meal, i, memory_order_release);
+		atomic_store_explicit(meals, atomic_load_explicit(meals,
+				memory_order_relaxed) + 1, memory_order_release);
+	}
+	return (NULL);
+}
+
+static void	run_layout(char *name, t_bench *b, int *fd)
+{
+	pthread_t			tid[257];
+	unsigned long long	count[2];
+	t_nsec				t;
+	int					i;
+
+	ioctl(fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	t = now_ns();
+	i = -1;
+	while (++i <= b->writers)
+		pthread_create(&tid[i], NULL, runner, b);
+	while (--i > 0)
+		pthread_join(tid[i], NULL);
+	atomic_store(&b->stop, 1);
+	pthread_join(tid[0], NULL);
+	t = now_ns() - t;
+	ioctl(fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	printf("%-7s %8.2f ns/meal", name, (double)t / b->writes);
+	if (fd[0] < 0 || read(fd[0], &count[0], 8) != 8
+		|| read(fd[1], &count[1], 8) != 8)
+		printf("   (perf counters unavailable)\n");
+	else
+		printf("   L1D misses/meal %6.3f   LLC misses/meal %6.3f\n",
+			(double)count[0] / (b->writes * b->writers),
+			(double)count[1] / (b->writes * b->writers));
+}
+
+int	main(int argc, char **argv)
+{
+	t_bench	b;
+	int		fd[2];
+
+	ft_bzero(&b, sizeof(b));
+	b.writers = cpu_count() - 1;
+	if (argc > 1)
+		b.writers = atoi(argv[1]);
+	b.writes = DEFAULT_WRITES;
+	if (argc > 2)
+		b.writes = atol(argv[2]);
+	if (b.writers < 1 || b.writers > 256 || b.writes <= 0)
+		return (1);
+	if (cpu_count() < 2)
+		printf("warning: 1 online CPU, threads never run concurrently\n");
+	perf_open(fd);
+	b.packed = ft_calloc(b.writers, sizeof(t_packed));
+	run_layout("packed", &b, fd);
+	free(b.packed);
+	b.packed = NULL;
+	b.hot = cache_alloc(b.writers, sizeof(t_philo_hot));
+	run_layout("padded", &b, fd);
+	free(b.hot);
+	return (0);
+}
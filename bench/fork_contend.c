@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_contend.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:48:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: fork backends under full contention. Every philosopher
+** loops take_forks() / drop_forks() with no eating or sleeping in between,
+** so throughput is bounded by the fork protocol alone. Prints total
+** acquisitions per second, the least and most served philosopher, and
+** the CPU time burnt.
+** usage: bench/fork_contend [philosophers] [milliseconds]
+*/
+
+#include "philosophers.h"
+
+typedef struct s_slot
+{
+	t_philo		*philo;
+	atomic_int	*stop;
+	long		count;
+}	t_slot;
+
+static void	*contender(void *arg)
+{
+	t_slot	*slot;
+
+	slot = (t_slot *)arg;
+	while (!atomic_load_explicit(slot->stop, memory_order_relaxed))
+	{
+		take_forks(slot->philo, slot->philo->table);
+		drop_forks(slot->philo);
+		slot->count++;
+	}
+	return (NULL);
+}
+
+static void	report(char *name, t_slot *slots, int n, long ms)
+{
+	long	total;
+	long	lo;
+	long	hi;
+	int		i;
+
+	total = 0;
+	lo = LONG_MAX;
+	hi = 0;
+	i = -1;
+	while (++i < n)
+	{
+		total += slots[i].count;
+		if (slots[i].count < lo)
+			lo = slots[i].count;
+		if (slots[i].count > hi)
+			hi = slots[i].count;
+	}
+	printf("%-9s %10.0f meals/s   per philosopher min %ld max %ld",
+		name, total * 1000.0 / ms, lo, hi);
+}
+
+/*
+** simulation stays 0, so print_status() drops every event and the bench
+** measures the forks, not the logger.
+*/
+static void	run_backend(t_table *table, char *name, long ms)
+{
+	pthread_t	tid[1024];
+	t_slot		slots[1024];
+	atomic_int	stop;
+	clock_t		cpu;
+	int			i;
+
+	atomic_init(&stop, 0);
+	cpu = clock();
+	i = -1;
+	while (++i < table->num_philos)
+	{
+		slots[i].philo = &table->philo[i];
+		slots[i].stop = &stop;
+		slots[i].count = 0;
+		pthread_create(&tid[i], NULL, contender, &slots[i]);
+	}
+	usleep(ms * 1000);
+	atomic_store(&stop, 1);
+	while (i-- > 0)
+		pthread_join(tid[i], NULL);
+	report(name, slots, table->num_philos, ms);
+	printf("   cpu %.3fs\n", (double)(clock() - cpu) / CLOCKS_PER_SEC);
+}
+
+static void	run_mode(char *name, t_fork_mode mode, int n, long ms)
+{
+	t_table	*table;
+
+	table = arena_alloc(n, HUGE_OFF);
+	if (!table)
+		return ;
+	table->num_philos = n;
+	table->opt.forks = mode;
+	if (init_table(table) == 0)
+		run_backend(table, name, ms);
+	cleanup(table);
+}
+
+int	main(int argc, char **argv)
+{
+	int		n;
+	long	ms;
+
+	n = 5;
+	if (argc > 1)
+		n = atoi(argv[1]);
+	ms = 1000;
+	if (argc > 2)
+		ms = atol(argv[2]);
+	if (n < 2 || n > 1024 || ms <= 0)
+		return (1);
+	run_mode("mutex", FORKS_ODD_EVEN, n, ms);
+	run_mode("futex", FORKS_FUTEX, n, ms);
+	return (0);
+}
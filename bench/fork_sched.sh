@@ -0,0 +1,53 @@
+#!/bin/sh
+# Compares fork strategies over a parameter matrix.
+# For every scenario and strategy it reports the number of runs that ended
+# in a death, the mean meal throughput (meals per second of simulated
+# time) and the minimum slack seen, where slack is time_to_die minus the
+# longest gap between two meals (or between start and the first meal) of
+# any philosopher.
+# usage: bench/fork_sched.sh [philo_binary] [repetitions]
+
+BIN=${1:-./philo}
+REPS=${2:-3}
+MODES="odd-even hierarchy seats chandy-misra ticket arbiter futex"
+LOG=${TMPDIR:-/tmp}/philo_fork_sched.log
+
+SCENARIOS="
+5 610 200 200 7
+5 800 200 200 7
+4 410 200 200 7
+3 610 200 200 7
+31 610 200 200 7
+200 610 200 200 5
+199 650 200 200 5
+"
+
+printf "%-22s %-13s %7s %9s %10s\n" "scenario" "mode" "deaths" \
+	"meals/s" "min_slack"
+echo "$SCENARIOS" | while read -r N DIE EAT SLEEP MUST; do
+	[ -z "$N" ] && continue
+	for MODE in $MODES; do
+		DEATHS=0
+		MIN=""
+		RATE=0
+		i=0
+		while [ $i -lt "$REPS" ]; do
+			"$BIN" "$N" "$DIE" "$EAT" "$SLEEP" "$MUST" --forks="$MODE" > "$LOG"
+			grep -q " died$" "$LOG" && DEATHS=$((DEATHS + 1))
+			S=$(awk -v die="$DIE" '
+				($3 == "is" && $4 == "eating") || $3 == "died" {
+					gap = $1 - last[$2]; last[$2] = $1
+					if (gap > worst) worst = gap
+				}
+				END { print die - worst }' "$LOG")
+			RATE=$(awk -v r="$RATE" '$3 == "is" && $4 == "eating" { n++ }
+				{ t = $1 } END { print r + (t > 0 ? n * 1000 / t : 0) }' "$LOG")
+			if [ -z "$MIN" ] || [ "$S" -lt "$MIN" ]; then MIN=$S; fi
+			i=$((i + 1))
+		done
+		printf "%-22s %-13s %4d/%-2d %9.1f %10s\n" \
+			"$N $DIE $EAT $SLEEP $MUST" "$MODE" "$DEATHS" "$REPS" \
+			"$(echo "$RATE $REPS" | awk '{ print $1 / $2 }')" "$MIN"
+	done
+done
+rm -f "$LOG"
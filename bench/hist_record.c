@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_record.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:04:36 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:04:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: hot-path cost of --stats=on. Times hist_record() alone,
+** stats_meal() (two records and the min-slack update) and the two clock
+** reads take_forks() adds around the acquisition.
+** usage: bench/hist_record [iterations]
+*/
+
+#include "philosophers.h"
+
+#define DEFAULT_ITERS 20000000L
+
+static double	bench_record(t_table *table, long iters)
+{
+	t_nsec	start;
+	long	i;
+
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		hist_record(&table->stats.philo[0].h[STAT_WAIT], i * 7919);
+		i++;
+	}
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+static double	bench_meal(t_table *table, long iters)
+{
+	t_nsec	start;
+	long	i;
+
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		stats_meal(&table->philo[0], table, 400000000 + (i & 0xfffff));
+		i++;
+	}
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+static double	bench_wait(t_table *table, long iters)
+{
+	t_nsec	start;
+	long	i;
+
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		hist_record(&table->stats.philo[0].h[STAT_WAIT], now_ns() - now_ns());
+		i++;
+	}
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+int	main(int argc, char **argv)
+{
+	t_table	table;
+	t_philo	philo;
+	long	iters;
+
+	iters = DEFAULT_ITERS;
+	if (argc > 1)
+		iters = atol(argv[1]);
+	if (iters <= 0)
+		return (1);
+	ft_bzero(&table, sizeof(table));
+	table.num_philos = 1;
+	table.time_to_die = 800;
+	table.opt.stats = 1;
+	philo.id = 1;
+	table.philo = &philo;
+	if (clock_setup(CLK_MONO) || stats_init(&table))
+		return (1);
+	printf("hist_record     %6.2f ns\n", bench_record(&table, iters));
+	printf("stats_meal      %6.2f ns\n", bench_meal(&table, iters));
+	printf("fork wait path  %6.2f ns (two clock reads + record)\n",
+		bench_wait(&table, iters));
+	stats_free(&table);
+	return (0);
+}
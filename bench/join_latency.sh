@@ -0,0 +1,42 @@
+#!/bin/sh
+# Shutdown latency: time from the run ending (the monitor flipping
+# simulation to 0) to the last philosopher thread being joined, collected
+# through --join-log. Every strategy in STRATEGIES, then --engine=tasks
+# (which ignores --forks), is run RUNS times at 5, 200 and 2000
+# philosophers, once for a run that ends in a death and once for a run
+# that ends with everybody full, and p50/max are printed.
+# usage: bench/join_latency.sh [philo_binary] [runs]
+# STRATEGIES overrides the --forks list (default: every strategy).
+
+BIN=${1:-./philo}
+RUNS=${2:-5}
+STRATEGIES=${STRATEGIES:-odd-even hierarchy seats chandy-misra ticket \
+arbiter futex}
+SAMPLES=${TMPDIR:-/tmp}/philo_join_latency.txt
+
+printf "%-13s %5s %-6s %12s %12s\n" forks philo end "p50 (us)" "max (us)"
+for FORKS in $STRATEGIES tasks; do
+	[ "$FORKS" = tasks ] && MODE=--engine=tasks || MODE=--forks="$FORKS"
+	for N in 5 200 2000; do
+		for END in death full; do
+			[ $END = death ] && ARGS="$N 400 200 300" \
+				|| ARGS="$N 5000 100 100 2"
+			rm -f "$SAMPLES"
+			i=0
+			while [ $i -lt "$RUNS" ]; do
+				# shellcheck disable=SC2086
+				"$BIN" "$MODE" --join-log="$SAMPLES" $ARGS \
+					> /dev/null 2>&1
+				i=$((i + 1))
+			done
+			cut -d' ' -f2 "$SAMPLES" | sort -n | awk -v f="$FORKS" \
+				-v n="$N" -v e="$END" '
+				{ v[NR] = $1 / 1e3 }
+				END {
+					printf "%-13s %5d %-6s %12.1f %12.1f\n", f, n, e,
+						v[int(NR * 0.50 + 0.999)], v[NR]
+				}'
+		done
+	done
+done
+rm -f "$SAMPLES"
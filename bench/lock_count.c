@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lock_count.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:11:39 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:11:39 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** LD_PRELOAD shim that counts pthread_mutex_lock() calls made by the process.
+** The total is written to stderr when the program exits, so the script can
+** divide it by the number of "is eating" lines found on stdout.
+*/
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+static atomic_ulong	g_locks;
+
+int	pthread_mutex_lock(pthread_mutex_t *mutex)
+{
+	static int	(*real)(pthread_mutex_t *);
+
+	if (!real)
+		real = (int (*)(pthread_mutex_t *))dlsym(RTLD_NEXT,
+				"pthread_mutex_lock");
+	atomic_fetch_add_explicit(&g_locks, 1, memory_order_relaxed);
+	return (real(mutex));
+}
+
+__attribute__((destructor))
+static void	report_locks(void)
+{
+	fprintf(stderr, "lock_count: %lu\n", atomic_load(&g_locks));
+}
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Counts pthread_mutex_lock() calls per meal.
+# usage: bench/lock_count.sh [philo_binary] [philo args...]
+# default args: 200 800 200 200 10
+
+BIN=${1:-./philo}
+[ $# -gt 0 ] && shift
+[ $# -eq 0 ] && set -- 200 800 200 200 10
+SHIM=${TMPDIR:-/tmp}/philo_lock_count.so
+
+cc -shared -fPIC -O2 -o "$SHIM" "$(dirname "$0")/lock_count.c" -ldl || exit 1
+LOG=${TMPDIR:-/tmp}/philo_lock_count.log
+OUT=$(LD_PRELOAD="$SHIM" "$BIN" "$@" 2>&1 >"$LOG" | grep lock_count)
+MEALS=$(grep -c "is eating" "$LOG")
+LOCKS=${OUT#lock_count: }
+rm -f "$LOG"
+echo "args:          $*"
+echo "meals:         $MEALS"
+echo "mutex locks:   $LOCKS"
+awk -v l="$LOCKS" -v m="$MEALS" 'BEGIN { if (m > 0) printf "locks/meal:    %.2f\n", l / m }'
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_line.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:13:59 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:15:33 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: ns per "timestamp id status" line for log_line() against
+** the ft_snprintf() it replaced in format_event() and libc snprintf().
+** Every line is checked byte for byte against snprintf first.
+** usage: bench/log_line [iterations]
+*/
+
+#include "philosophers.h"
+
+#define DEFAULT_ITERS 10000000L
+
+static int	check(long iters)
+{
+	char	a[LOG_LINE_MAX];
+	char	b[LOG_LINE_MAX];
+	size_t	n;
+	long	i;
+
+	i = 0;
+	while (i < iters)
+	{
+		n = log_line(a, i * 7919, i % 200 + 1, i % 5);
+		a[n] = '\0';
+		snprintf(b, sizeof(b), "%ld %d %s\n", i * 7919, (int)(i % 200 + 1),
+			state_name(i % 5));
+		if (ft_strncmp(a, b, LOG_LINE_MAX))
+			return (printf("mismatch: %s vs %s", a, b), 1);
+		i++;
+	}
+	return (0);
+}
+
+static double	bench_line(char *buf, long iters)
+{
+	t_nsec	start;
+	long	i;
+	size_t	len;
+
+	len = 0;
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		len += log_line(buf + (len & 0xfff), i, i & 0xff, i % 5);
+		i++;
+	}
+	buf[0] += len;
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+static double	bench_ft(char *buf, long iters)
+{
+	t_nsec	start;
+	long	i;
+	size_t	len;
+
+	len = 0;
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		len += ft_snprintf(buf + (len & 0xfff), LOG_LINE_MAX, "%ld %d %s\n",
+				i, (int)(i & 0xff), state_name(i % 5));
+		i++;
+	}
+	buf[0] += len;
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+static double	bench_libc(char *buf, long iters)
+{
+	t_nsec	start;
+	long	i;
+	size_t	len;
+
+	len = 0;
+	start = clock_read(CLK_MONO);
+	i = 0;
+	while (i < iters)
+	{
+		len += snprintf(buf + (len & 0xfff), LOG_LINE_MAX, "%ld %d %s\n",
+				i, (int)(i & 0xff), state_name(i % 5));
+		i++;
+	}
+	buf[0] += len;
+	return ((double)(clock_read(CLK_MONO) - start) / iters);
+}
+
+int	main(int argc, char **argv)
+{
+	static char	buf[4096 + LOG_LINE_MAX];
+	long		iters;
+
+	iters = DEFAULT_ITERS;
+	if (argc > 1)
+		iters = atol(argv[1]);
+	if (iters <= 0 || clock_setup(CLK_MONO) || check(100000))
+		return (1);
+	printf("log_line        %6.2f ns/line\n", bench_line(buf, iters));
+	printf("ft_snprintf     %6.2f ns/line\n", bench_ft(buf, iters));
+	printf("snprintf        %6.2f ns/line\n", bench_libc(buf, iters));
+	return (0);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rusage.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:58:54 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:58:54 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Runs a command with its stdout sent to a file and reports what wait4()
+** says it cost, on one line:
+**   wall_ms user_ms sys_ms voluntary_csw involuntary_csw max_rss_kb status
+** usage: bench/rusage out_file command [args...]
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e3 + ts.tv_nsec / 1e6);
+}
+
+static double	tv_ms(struct timeval tv)
+{
+	return (tv.tv_sec * 1e3 + tv.tv_usec / 1e3);
+}
+
+static int	exit_code(int status)
+{
+	if (WIFEXITED(status))
+		return (WEXITSTATUS(status));
+	return (128 + WTERMSIG(status));
+}
+
+static void	child(char *out, char **argv)
+{
+	int	fd;
+
+	fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0 || dup2(fd, STDOUT_FILENO) < 0)
+	{
+		perror(out);
+		exit(127);
+	}
+	close(fd);
+	execvp(argv[0], argv);
+	perror(argv[0]);
+	exit(127);
+}
+
+int	main(int argc, char **argv)
+{
+	struct rusage	ru;
+	double			start;
+	pid_t			pid;
+	int				status;
+
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s out_file command [args...]\n", argv[0]);
+		return (2);
+	}
+	start = now_ms();
+	pid = fork();
+	if (pid == 0)
+		child(argv[1], argv + 2);
+	if (pid < 0 || wait4(pid, &status, 0, &ru) < 0)
+	{
+		perror("rusage");
+		return (1);
+	}
+	printf("%.1f %.1f %.1f %ld %ld %ld %d\n", now_ms() - start,
+		tv_ms(ru.ru_utime), tv_ms(ru.ru_stime), ru.ru_nvcsw, ru.ru_nivcsw,
+		ru.ru_maxrss, exit_code(status));
+	return (0);
+}
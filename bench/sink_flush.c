@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_flush.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:20:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmark: the logger's output path through each --sink backend.
+** Formats lines into the writer buffer as format_event() does, with a
+** tick flush every TICK_LINES lines and a full flush when the buffer runs
+** out, and times every logger_flush() call. Output goes to a regular file
+** so the mmap sink applies, and results go to stderr: lines/s and the
+** p50/p99/max of one flush.
+** usage: bench/sink_flush [lines] [file]
+*/
+
+#include "philosophers.h"
+
+#define DEFAULT_LINES 2000000L
+#define TICK_LINES 256
+#define DEFAULT_FILE "/tmp/philo_sink_flush.log"
+
+static int	nsec_cmp(const void *a, const void *b)
+{
+	const t_nsec	*x;
+	const t_nsec	*y;
+
+	x = (const t_nsec *)a;
+	y = (const t_nsec *)b;
+	return ((*x > *y) - (*x < *y));
+}
+
+static long	fill(t_logger *log, long lines, t_nsec *lat)
+{
+	t_nsec	t;
+	long	n;
+	long	i;
+
+	n = 0;
+	i = 0;
+	while (i < lines)
+	{
+		log->len += log_line(log->buf + log->len, i / 8, i % 200 + 1, i % 5);
+		i++;
+		if (i % TICK_LINES && log->len + LOG_LINE_MAX <= LOG_BUF_SIZE)
+			continue ;
+		t = clock_read(CLK_MONO);
+		logger_flush(log, log->len + LOG_LINE_MAX > LOG_BUF_SIZE);
+		lat[n++] = clock_read(CLK_MONO) - t;
+	}
+	return (n);
+}
+
+static void	report(const char *name, t_nsec *lat, long n, double rate)
+{
+	qsort(lat, n, sizeof(t_nsec), nsec_cmp);
+	dprintf(2, "%-8s %6.2f Mlines/s  flush p50 %7.2f us  p99 %8.2f us"
+		"  max %8.2f us\n", name, rate / 1e6, lat[n / 2] / 1e3,
+		lat[n * 99 / 100] / 1e3, lat[n - 1] / 1e3);
+}
+
+static int	run_sink(t_sink_mode mode, long lines, const char *path)
+{
+	t_table	table;
+	t_nsec	*lat;
+	t_nsec	start;
+	long	n;
+	int		fd;
+
+	ft_bzero(&table, sizeof(table));
+	table.opt.sink = mode;
+	table.log.buf = malloc(LOG_BUF_SIZE);
+	lat = malloc(sizeof(t_nsec) * (lines / TICK_LINES + 1));
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (!table.log.buf || !lat || fd < 0 || dup2(fd, 1) < 0)
+		return (1);
+	close(fd);
+	sink_open(&table);
+	start = clock_read(CLK_MONO);
+	n = fill(&table.log, lines, lat);
+	sink_close(&table.log);
+	report(sink_of(mode)->name, lat, n,
+		lines / ((clock_read(CLK_MONO) - start) / 1e9));
+	free(table.log.buf);
+	free(lat);
+	return (0);
+}
+
+int	main(int argc, char **argv)
+{
+	const char	*path;
+	long		lines;
+	int			mode;
+
+	lines = DEFAULT_LINES;
+	if (argc > 1)
+		lines = atol(argv[1]);
+	path = DEFAULT_FILE;
+	if (argc > 2)
+		path = argv[2];
+	if (lines < TICK_LINES || clock_setup(CLK_MONO))
+		return (1);
+	mode = 0;
+	while (mode < SINKS_COUNT)
+		if (run_sink(mode++, lines, path))
+			return (1);
+	if (argc <= 2)
+		unlink(path);
+	return (0);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep_overshoot.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:17:37 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Compares the old 100us polling ft_usleep() with the hybrid sleep_until():
+** overshoot percentiles past the deadline and CPU time burnt while sleeping.
+** usage: bench/sleep_overshoot [threads] [sleeps_per_thread] [sleep_ms]
+*/
+
+#include "philosophers.h"
+#include <sys/resource.h>
+
+typedef struct s_run
+{
+	int		poll;
+	long	sleeps;
+	long	ms;
+	t_nsec	*over;
+}	t_run;
+
+static void	*sleeper(void *arg)
+{
+	t_run	*run;
+	t_nsec	deadline;
+	long	i;
+
+	run = (t_run *)arg;
+	i = 0;
+	while (i < run->sleeps)
+	{
+		deadline = now_ns() + run->ms * NS_PER_MS;
+		if (run->poll)
+		{
+			while (now_ns() < deadline)
+				usleep(100);
+		}
+		else
+			sleep_until(deadline, NULL);
+		run->over[i] = now_ns() - deadline;
+		i++;
+	}
+	return (NULL);
+}
+
+static int	cmp_nsec(const void *a, const void *b)
+{
+	return ((*(t_nsec *)a > *(t_nsec *)b) - (*(t_nsec *)a < *(t_nsec *)b));
+}
+
+static double	cpu_seconds(void)
+{
+	struct rusage	ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec
+		+ (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e6);
+}
+
+static void	run_mode(char *name, t_run *runs, int threads, t_nsec *all)
+{
+	pthread_t	tid[256];
+	double		cpu;
+	long		n;
+	int			i;
+
+	cpu = cpu_seconds();
+	i = -1;
+	while (++i < threads)
+		pthread_create(&tid[i], NULL, sleeper, &runs[i]);
+	i = -1;
+	while (++i < threads)
+		pthread_join(tid[i], NULL);
+	cpu = cpu_seconds() - cpu;
+	n = (long)threads * runs[0].sleeps;
+	qsort(all, n, sizeof(t_nsec), cmp_nsec);
+	printf("%-7s overshoot us: p50 %7.1f  p90 %7.1f  p99 %7.1f  max %7.1f"
+		"   cpu %.3fs\n", name, all[n / 2] / 1e3, all[n * 9 / 10] / 1e3,
+		all[n * 99 / 100] / 1e3, all[n - 1] / 1e3, cpu);
+}
+
+int	main(int argc, char **argv)
+{
+	t_run	runs[256];
+	t_nsec	*all;
+	int		threads;
+	int		i;
+
+	threads = 20;
+	if (argc > 1)
+		threads = atoi(argv[1]);
+	if (threads < 1 || threads > 256)
+		return (1);
+	all = malloc(sizeof(t_nsec) * threads * 1000);
+	i = -1;
+	while (all && ++i < threads)
+	{
+		runs[i].sleeps = 100;
+		if (argc > 2 && atol(argv[2]) > 0 && atol(argv[2]) <= 1000)
+			runs[i].sleeps = atol(argv[2]);
+		runs[i].ms = 10;
+		if (argc > 3)
+			runs[i].ms = atol(argv[3]);
+		runs[i].over = all + (long)i * runs[i].sleeps;
+		runs[i].poll = 1;
+	}
+	if (!all)
+		return (1);
+	run_mode("poll", runs, threads, all);
+	i = -1;
+	while (++i < threads)
+		runs[i].poll = 0;
+	run_mode("hybrid", runs, threads, all);
+	free(all);
+	return (0);
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Startup cost per --stack-size: time from the first pthread_create() to
+# the start epoch, start skew, and process VSZ/RSS per philosopher just
+# after the start, read from the --stats report. Each row is the median
+# of RUNS runs of "N 60000 200 200 1" (nobody dies, one meal each).
+# usage: bench/spawn.sh [philo_binary] [runs]
+# SPAWN_N and SPAWN_STACKS override the sizes (defaults: 1000 10000 and
+# 0 64 16, in KiB, 0 being the 8 MiB default).
+
+BIN=${1:-./philo}
+RUNS=${2:-3}
+SIZES=${SPAWN_N:-1000 10000}
+STACKS=${SPAWN_STACKS:-0 64 16}
+
+printf "%6s %6s %11s %11s %9s %9s\n" philo stack "spawn (ms)" \
+	"skew (ms)" "vsz KiB" "rss KiB"
+for N in $SIZES; do
+	for STACK in $STACKS; do
+		i=0
+		while [ $i -lt "$RUNS" ]; do
+			"$BIN" --stats=on --trace=none --stack-size="$STACK" \
+				"$N" 60000 200 200 1 2>&1 > /dev/null \
+				| awk '/^spawn/ { s = $2; v = $4; r = $7 }
+					/^start skew/ { print s, $3, v, r }'
+			i=$((i + 1))
+		done | sort -n | awk -v n="$N" -v k="$STACK" -v runs="$RUNS" '
+			NR == int((runs + 1) / 2) {
+				printf "%6d %6d %11.3f %11.3f %9d %9d\n", n, k, $1, $2,
+					$3, $4
+			}'
+	done
+done
@@ -0,0 +1,75 @@
+#!/bin/sh
+# End-to-end benchmark: runs philo over a scenario matrix with repetitions.
+# Every run goes through bench/rusage (fork + wait4) and records wall time,
+# meals/s, user and system CPU time, voluntary and involuntary context
+# switches, max RSS and, for runs that end in a death, the detection
+# latency: the "died" timestamp minus the deadline implied by the last
+# "is eating" line of that philosopher (last meal + time_to_die + 1 ms).
+# One CSV row per run goes to the results file, a per-scenario summary of
+# means to stdout.
+# usage: bench/suite.sh [philo_binary] [repetitions] [results.csv]
+# Options for philo can be passed in BENCH_ARGS, e.g. BENCH_ARGS=--forks=futex
+
+BIN=${1:-./philo}
+REPS=${2:-5}
+CSV=${3:-bench/results.csv}
+RUSAGE=$(dirname "$0")/rusage
+LOG=${TMPDIR:-/tmp}/philo_suite.log
+
+# num_philos die eat sleep must_eat ("-" for none)
+SCENARIOS="
+5 800 200 200 10
+4 410 200 200 10
+31 610 200 200 10
+200 800 200 200 10
+1000 1200 200 200 5
+1 800 200 200 -
+4 310 200 100 -
+5 250 200 200 -
+"
+
+[ -x "$RUSAGE" ] || { echo "missing $RUSAGE (make bench builds it)"; exit 1; }
+echo "scenario,rep,status,wall_ms,meals,meals_per_s,user_ms,sys_ms,\
+vcsw,ivcsw,max_rss_kb,death_latency_ms" > "$CSV"
+echo "$SCENARIOS" | while read -r N DIE EAT SLEEP MUST; do
+	[ -z "$N" ] && continue
+	[ "$MUST" = "-" ] && MUST=""
+	i=1
+	while [ "$i" -le "$REPS" ]; do
+		# shellcheck disable=SC2086
+		RU=$("$RUSAGE" "$LOG" "$BIN" $N $DIE $EAT $SLEEP $MUST $BENCH_ARGS)
+		awk -v die="$DIE" -v sc="$N $DIE $EAT $SLEEP${MUST:+ $MUST}" \
+			-v rep="$i" -v ru="$RU" '
+			$3 == "is" && $4 == "eating" { n++; last[$2] = $1 }
+			$3 == "died" { lat = $1 - (last[$2] + die + 1) }
+			END {
+				split(ru, r, " ")
+				printf "%s,%d,%d,%.1f,%d,%.1f,%.1f,%.1f,%d,%d,%d,%s\n",
+					sc, rep, r[7], r[1], n, (r[1] > 0 ? n * 1000 / r[1] : 0),
+					r[2], r[3], r[4], r[5], r[6], lat
+			}' "$LOG" >> "$CSV"
+		i=$((i + 1))
+	done
+done
+rm -f "$LOG"
+
+awk -F, 'NR > 1 {
+	k = $1
+	if (!(k in seen)) { seen[k] = 1; order[++m] = k }
+	runs[k]++; deaths[k] += ($12 != "")
+	mps[k] += $6; cpu[k] += $7 + $8; csw[k] += $9 + $10
+	if ($11 > rss[k]) rss[k] = $11
+	if ($12 != "") { lat[k] += $12; if ($12 > latmax[k]) latmax[k] = $12 }
+}
+END {
+	printf "%-22s %6s %9s %9s %8s %8s %11s\n", "scenario", "deaths",
+		"meals/s", "cpu_ms", "csw", "rss_kb", "detect_ms"
+	for (j = 1; j <= m; j++) {
+		k = order[j]
+		d = deaths[k] ? sprintf("%.1f/%d", lat[k] / deaths[k], latmax[k]) : "-"
+		printf "%-22s %3d/%-2d %9.1f %9.1f %8.0f %8d %11s\n", k, deaths[k],
+			runs[k], mps[k] / runs[k], cpu[k] / runs[k], csw[k] / runs[k],
+			rss[k], d
+	}
+	print "detect_ms is mean/max death-detection latency; rows in " FILENAME
+}' "$CSV"
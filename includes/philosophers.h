@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/20 00:13:21 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 19:01:40 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,12 +19,21 @@
 
 # include "types.h"			// structs, enums
 # include "libft.h"			// libft expanded
-# include <string.h>		// memset
+# include <string.h>		// memset, memcpy
 # include <stdio.h>			// printf
 # include <stdlib.h>		// malloc, free
 # include <unistd.h>		// write, usleep
-# include <sys/time.h>		// gettimeofday
+# include <time.h>			// clock_gettime, nanosleep
 # include <pthread.h>		// Todas as pthread_*
+# include <sched.h>			// sched_yield
+# include <limits.h>		// LONG_MAX
+# include <errno.h>			// EINTR
+# include <linux/futex.h>	// FUTEX_*
+# include <sys/syscall.h>	// SYS_futex
+# include <sys/mman.h>		// mmap, munmap
+# include <fcntl.h>			// open
+# include <sys/stat.h>		// fstat
+# include <signal.h>		// sigwait, pthread_kill
 
 /* ========================================================================
 ** DEFINES & CONSTANTS
@@ -35,6 +44,39 @@
 # define TRUE 1
 # define FALSE 0
 
+# define NS_PER_US 1000L
+# define NS_PER_MS 1000000L
+# define NS_PER_SEC 1000000000L
+# define TSC_CALIBRATION_MS 20
+# define SLEEP_TAIL_US 200
+# define MONITOR_SHARD_MIN 1024
+# define FORK_BLOCK 15
+# define FORK_WAITERS 15
+# define FORK_STOP 0x40000000
+# define TICKET_STOP 0x40000000
+# define ARBITER_STOP 2
+# define FORK_SPIN_MAX 100
+# define DES_ID_BITS 21
+# define DES_JITTER_US 500
+# define TASK_STACK_SIZE 32768
+# define PHILO_STACK_KIB 64
+# define SPAWN_FANOUT 2
+# define HUGE_PAGE_SIZE 2097152
+# define POOL_IDLE_US 10000
+# define STATS_WORST 5
+
+# define LOG_BUF_SIZE 65536
+# define LOG_LINE_MAX 96
+# define LOG_TICK_US 1000
+# define SINK_MAP_CHUNK 4194304
+
+# define TRACE_MAGIC "PHTRACE1"
+# define TRACE_VERSION 1
+# define TRACE_HEADER_SIZE 24
+# define TRACE_RECORD_SIZE 8
+# define TRACE_STATE_BITS 3
+# define TRACE_ADVANCE 7
+
 /* ========================================================================
 ** FUNCTION PROTOTYPES
 ** ======================================================================== */
@@ -44,30 +86,255 @@ int		main(int argc, char **argv);
 
 /* Philosopher functions (philosopher.c and routines.c) */
 void	*philo_routine(void *arg);
-void	take_forks(t_philo *philo, t_table *table);
+int		take_forks(t_philo *philo, t_table *table);
 void	drop_forks(t_philo *philo);
 void	philo_eat(t_philo *philo, t_table *table);
 void	philo_sleep(t_table *table, int philo_id);
 void	philo_think(t_table *table, int philo_id);
+void	philo_wait(t_table *table, int philo_id, long msecs);
+void	philo_wait_until(t_table *table, int philo_id, t_nsec deadline);
+
+/* Output sinks (sink.c, sink_writev.c, sink_mmap.c and sink_uring*.c) */
+const t_sink		*sink_of(t_sink_mode mode);
+int		sink_open(t_table *table);
+void	sink_close(t_logger *log);
+void	write_flush(t_logger *log, int full);
+int		writev_open(t_logger *log);
+void	writev_flush(t_logger *log, int full);
+void	writev_close(t_logger *log);
+int		mmap_open(t_logger *log);
+void	mmap_flush(t_logger *log, int full);
+void	mmap_close(t_logger *log);
+int		uring_open(t_logger *log);
+void	uring_flush(t_logger *log, int full);
+void	uring_close(t_logger *log);
+
+/* Fork strategies (fork_strategy.c) */
+const t_strategy	*strategy_of(t_fork_mode mode);
+
+/* Mutex-based strategies (fork_mutex.c and fork_seats.c) */
+void	mutex_lock_pair(t_philo *philo, t_table *table,
+			pthread_mutex_t *first, pthread_mutex_t *second);
+int		odd_even_acquire(t_philo *philo, t_table *table);
+int		hierarchy_acquire(t_philo *philo, t_table *table);
+void	mutex_release(t_philo *philo, t_table *table);
+int		seats_init(t_table *table);
+void	seats_free(t_table *table);
+int		seats_acquire(t_philo *philo, t_table *table);
+void	seats_release(t_philo *philo, t_table *table);
+void	seats_stop(t_table *table);
+
+/* Ticket strategy (fork_ticket.c) */
+int		ticket_acquire(t_philo *philo, t_table *table);
+void	ticket_release(t_philo *philo, t_table *table);
+void	ticket_stop(t_table *table);
+
+/* Chandy-Misra strategy (fork_chandy.c and fork_chandy_init.c) */
+int		chandy_init(t_table *table);
+void	chandy_free(t_table *table);
+int		chandy_acquire(t_philo *philo, t_table *table);
+void	chandy_release(t_philo *philo, t_table *table);
+void	chandy_stop(t_table *table);
+
+/* Futex fork backend (fork_futex*.c and fork_rival.c) */
+int			futex_take_forks(t_philo *philo, t_table *table);
+void		futex_drop_forks(t_philo *philo, t_table *table);
+void		futex_on_think(t_philo *philo, t_table *table);
+void		fork_block_release(atomic_int *word, int mask);
+int			futex_init(t_table *table);
+void		futex_free(t_table *table);
+t_hunger	*fork_rival(t_philo *philo, t_table *table);
+void		fork_wait_rival(t_hunger *rival);
+void		fork_fed(t_hunger *me);
+void		futex_stop(t_table *table);
+
+/* Arbiter fork scheduler (arbiter.c and arbiter_init.c) */
+int		arbiter_init(t_table *table);
+void	arbiter_free(t_table *table);
+int		arbiter_take(t_philo *philo, t_table *table);
+void	arbiter_drop(t_philo *philo, t_table *table);
+void	arbiter_stop(t_table *table);
+
+/* Discrete-event engine (des.c, des_init.c and des_step.c) */
+int		des_init(t_table *table);
+void	des_free(t_table *table);
+int		des_run(t_table *table);
+void	des_emit(t_table *table, t_des *des, int i, t_state state);
+void	des_advance(t_table *table, t_des *des, int i);
+void	des_release(t_table *table, t_des *des, int i);
+void	des_schedule(t_table *table, t_des *des, int i, long delay);
+
+/* Task engine (pool*.c and task*.c) */
+int		pool_init(t_table *table);
+void	pool_free(t_table *table);
+int		pool_start(t_table *table);
+void	pool_join(t_table *table);
+void	pool_stop(t_table *table);
+void	*worker_routine(void *arg);
+void	deque_push(t_deque *dq, t_task *task);
+t_task	*deque_pop(t_deque *dq);
+t_task	*deque_steal(t_deque *dq);
+void	pool_ready(t_worker *worker, t_task *task);
+t_task	*worker_next(t_worker *worker);
+void	task_entry(t_task *task);
+void	task_ctx_init(t_task *task, char *stack);
+void	task_ctx_switch(t_task_ctx *save, t_task_ctx *load);
+void	task_switch(t_task *task, t_park park);
+void	task_sleep(t_task *task, t_nsec deadline);
+void	task_fork_take(t_task *task, t_task_fork *fork);
+void	task_fork_drop(t_task *task, t_task_fork *fork);
+void	task_fork_park(t_worker *worker, t_task *task);
+void	task_take_forks(t_philo *philo, t_table *table);
+void	task_drop_forks(t_philo *philo, t_table *table);
 
 /* Monitor functions (monitor.c) */
+int		monitor_init(t_monitor *mon, t_table *table, int first, int count);
 void	*monitor_routine(void *arg);
-int		check_death(t_table *table);
+int		check_death(t_monitor *mon);
 int		check_all_ate(t_table *table);
 
-/* Output functions (output.c) */
-void	print_status(t_table *table, int philo_id, char *status);
-void	print_death(t_table *table, int philo_id);
+/* Monitor shards (monitor_shards.c and affinity.c) */
+int		monitors_init(t_table *table);
+int		monitors_start(t_table *table);
+void	monitors_join(t_table *table, int started);
+void	monitors_free(t_table *table);
+int		cpu_count(void);
+void	pin_to_shard(t_table *table, int shard);
+void	cpu_relax(void);
+int		spin_budget(int average);
+
+/* Monitor wakeups (monitor_wake.c) */
+void	monitor_wake(t_monitor *mon);
+void	monitors_wake(t_table *table);
 
-/* Time functions (time.c) */
-long	get_time_ms(void);
-long	get_elapsed_time_ms(long s_time);
+/* Start barrier and thread spawning (start.c and spawn*.c) */
+void	start_arrive(t_table *table, int count);
+void	start_wait(t_table *table);
+int		start_open(t_table *table, int expected);
+t_nsec	start_offset(t_table *table, int philo_id);
+int		spawn_init(t_table *table);
+void	spawn_free(t_table *table);
+void	spawn_measure(t_table *table);
+int		spawn_one(t_table *table, int i);
+void	spawn_children(t_philo *philo);
+void	*philo_thread(void *arg);
+
+/* Death-detection and shutdown latency probes (death_probe.c) */
+void	death_printed(t_table *table);
+int		death_report(t_table *table);
+int		join_report(t_table *table, t_nsec joined);
+
+/* Per-philosopher histograms (stats*.c) */
+int		stats_init(t_table *table);
+void	stats_free(t_table *table);
+int		hist_bucket(t_nsec v);
+void	hist_record(t_hist *hist, t_nsec v);
+void	stats_meal(t_philo *philo, t_table *table, t_nsec interval);
+void	stats_report(t_table *table);
+double	stats_jain(t_table *table);
+void	stats_worst(t_table *table, int count);
+
+/* Flight recorder (flight.c and flight_dump.c) */
+int		flight_init(t_table *table);
+void	flight_free(t_table *table);
+void	flight_record(t_flight *flight, t_nsec ts, t_state state);
+void	flight_dump(t_table *table, int philo_id, const char *why);
+void	flight_dump_likely(t_table *table);
+
+/* Signal thread (signals.c) */
+int		signals_start(t_table *table);
+void	signals_stop(t_table *table);
+
+/* Simulation lifecycle (simulation.c) */
+int		end_simulation(t_table *table);
+
+/* Indexed min-heap (heap.c and heap_sift.c) */
+int		heap_init(t_heap *heap, int cap);
+void	heap_free(t_heap *heap);
+void	heap_push(t_heap *heap, int item, t_nsec key);
+int		heap_pop(t_heap *heap);
+void	heap_update(t_heap *heap, int item, t_nsec key);
+void	heap_sift_up(t_heap *heap, int i);
+void	heap_sift_down(t_heap *heap, int i);
+
+/* Futex wrappers (futex.c) */
+long	futex_wait(atomic_int *addr, int expected);
+long	futex_wait_until(atomic_int *addr, int expected, t_nsec deadline);
+long	futex_wake(atomic_int *addr, int count);
+long	futex_wait_mask(atomic_int *addr, int expected, int mask);
+long	futex_wake_mask(atomic_int *addr, int mask);
+
+/* Output functions (output.c, log_line.c and trace.c) */
+void	print_status(t_table *table, int philo_id, t_state state);
+void	print_death(t_table *table, int philo_id, t_nsec deadline, t_nsec seen);
+void	print_all_ate(t_table *table);
+char	*state_name(t_state state);
+char	*put_uint(char *dst, unsigned long v);
+size_t	log_line(char *dst, long ts, int id, t_state state);
+void	format_event(t_table *table, t_event *ev);
+void	trace_begin(t_table *table);
+void	trace_event(t_table *table, t_event *ev);
+
+/* Async logger (logger.c and logger_*.c) */
+int		logger_init(t_table *table);
+int		logger_start(t_table *table);
+void	logger_stop(t_table *table);
+void	logger_destroy(t_table *table);
+void	logger_flush(t_logger *log, int full);
+int		ring_push(t_table *table, t_ring *ring, int id, t_state state);
+size_t	ring_drain(t_ring *ring, t_event *dst, size_t room);
+void	ring_wait_idle(t_ring *ring);
+void	ring_mark(t_logger *log, int i);
+t_nsec	logger_collect(t_table *table, t_nsec wm);
+int		events_have_terminal(t_event *ev, size_t n);
+void	*logger_routine(void *arg);
+
+/* Time functions (time.c, time_source.c, time_tick.c and time_tsc.c) */
+t_clock	*clock_state(void);
+int		clock_setup(t_clock_src src);
+t_nsec	clock_read(t_clock_src src);
+t_nsec	now_ns(void);
+t_nsec	now_precise(void);
+int		clock_tick_start(long tick_us);
+void	clock_tick_stop(void);
 int		ft_usleep(long msecs);
+void	sleep_until(t_nsec deadline, atomic_int *stop);
+void	sleep_set_tail(long usecs);
+t_nsec	*sleep_tail(void);
+
+/* TSC helpers (time_tsc.c) */
+int			tsc_supported(void);
+uint64_t	tsc_read(void);
+
+/* Option functions (options.c and option_values*.c) */
+int		parse_options(int *ac, char **av, t_options *opt);
+int		option_number(char *val, long *out);
+int		opt_log_policy(t_options *opt, char *val);
+int		opt_clock(t_options *opt, char *val);
+int		opt_sleep_tail(t_options *opt, char *val);
+int		opt_monitors(t_options *opt, char *val);
+int		opt_forks(t_options *opt, char *val);
+int		opt_engine(t_options *opt, char *val);
+int		opt_seed(t_options *opt, char *val);
+int		opt_death_log(t_options *opt, char *val);
+int		opt_stats(t_options *opt, char *val);
+int		opt_trace(t_options *opt, char *val);
+int		opt_sink(t_options *opt, char *val);
+int		opt_clock_tick(t_options *opt, char *val);
+int		opt_join_log(t_options *opt, char *val);
+int		opt_stack_size(t_options *opt, char *val);
+int		opt_hugepages(t_options *opt, char *val);
 
 /* Utils functions (utils.c) */
 int		validate_args(int ac, char **av);
 int		parser(int ac, char **av, t_table *table);
 int		init_table(t_table *table);
+t_table	*table_alloc(char **av, t_options *opt);
+void	*cache_alloc(size_t n, size_t size);
+
+/* Table arena (arena.c) */
+t_table	*arena_alloc(int n, t_huge_mode huge);
+void	arena_free(t_table *table);
 
 /* Cleanup and error functions (cleanup_and_error.c) */
 void	return_error(char *error_msg);
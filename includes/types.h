@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:15:45 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 20:31:56 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,38 +14,711 @@
 # define TYPES_H
 
 # include <pthread.h>
+# include <semaphore.h>
+# include <stdatomic.h>
+# include <stdint.h>
 # include <sys/time.h>
+# include <ucontext.h>
+# include <sys/types.h>
+# include <sys/uio.h>
+# include <linux/io_uring.h>
+
+/* ========================================================================
+** DEFINES
+** ======================================================================== */
+
+# define LOG_RING_SIZE 256
+# define CACHE_LINE 64
+# define FLIGHT_EVENTS 16
+# define HIST_SUB_BITS 4
+# define HIST_SUB 16
+# define HIST_MAX_EXP 36
+# define HIST_BUCKETS 544
+# define LOG_IOV_MAX 8
+
+/* ========================================================================
+** ENUMS
+** ======================================================================== */
+
+typedef enum e_state
+{
+	ST_FORK,
+	ST_EAT,
+	ST_SLEEP,
+	ST_THINK,
+	ST_DIED,
+	ST_ALL_ATE
+}	t_state;
+
+typedef enum e_clock_src
+{
+	CLK_MONO,
+	CLK_COARSE,
+	CLK_TSC
+}	t_clock_src;
+
+typedef enum e_fork_mode
+{
+	FORKS_ODD_EVEN,
+	FORKS_HIERARCHY,
+	FORKS_SEATS,
+	FORKS_CHANDY_MISRA,
+	FORKS_TICKET,
+	FORKS_ARBITER,
+	FORKS_FUTEX,
+	FORKS_COUNT
+}	t_fork_mode;
+
+typedef enum e_engine
+{
+	ENGINE_THREADS,
+	ENGINE_DES,
+	ENGINE_TASKS
+}	t_engine;
+
+/* Why a task switched back to its worker, handled on the worker's stack */
+typedef enum e_park
+{
+	PARK_TIMER,
+	PARK_FORK,
+	PARK_EXIT
+}	t_park;
+
+typedef enum e_des_phase
+{
+	PH_THINK,
+	PH_WANT_FIRST,
+	PH_WANT_SECOND,
+	PH_EAT_DONE
+}	t_des_phase;
+
+/* Per-philosopher histograms kept with --stats=on */
+typedef enum e_stat
+{
+	STAT_WAIT,
+	STAT_INTERVAL,
+	STAT_SLACK,
+	STAT_COUNT
+}	t_stat;
+
+typedef enum e_trace
+{
+	TRACE_TEXT,
+	TRACE_BINARY,
+	TRACE_NONE
+}	t_trace;
+
+typedef enum e_huge_mode
+{
+	HUGE_OFF,
+	HUGE_THP,
+	HUGE_TLB
+}	t_huge_mode;
+
+typedef enum e_sink_mode
+{
+	SINK_WRITE,
+	SINK_WRITEV,
+	SINK_MMAP,
+	SINK_URING,
+	SINKS_COUNT
+}	t_sink_mode;
+
+typedef enum e_log_policy
+{
+	LOG_BLOCK,
+	LOG_DROP
+}	t_log_policy;
 
 /* ========================================================================
 ** STRUCTURES
 ** ======================================================================== */
 
+/* Monotonic timestamp in nanoseconds */
+typedef int64_t			t_nsec;
+
 typedef struct s_table	t_table;
 
+typedef struct s_heap_node
+{
+	t_nsec	key;
+	int		item;
+}	t_heap_node;
+
+/*
+** Indexed binary min-heap: pos[item] is the slot of item in nodes, or -1
+** when it is not queued, so keys can be changed in O(log n).
+*/
+typedef struct s_heap
+{
+	t_heap_node	*nodes;
+	int			*pos;
+	int			size;
+	int			cap;
+}	t_heap;
+
+/*
+** Time published by the --clock-tick service thread: now is rewritten
+** every tick_ns from the clock source and read by now_ns() in place of the
+** clock. It has a cache line to itself, so only the tick ever invalidates
+** the readers' copies.
+*/
+typedef struct s_clock_tick
+{
+	_Alignas(CACHE_LINE) _Atomic t_nsec	now;
+	_Alignas(CACHE_LINE) atomic_int		running;
+	pthread_t							thread;
+	t_nsec								tick_ns;
+}	t_clock_tick;
+
+/*
+** Process-wide clock configuration. For CLK_TSC, readings are mapped onto
+** the CLOCK_MONOTONIC timeline through the base pair taken at calibration.
+*/
+typedef struct s_clock
+{
+	t_clock_src		src;
+	uint64_t		base_tsc;
+	t_nsec			base_ns;
+	double			ns_per_tick;
+	t_clock_tick	tick;
+}	t_clock;
+
+typedef struct s_options
+{
+	t_log_policy	log_policy;
+	t_clock_src		clock;
+	long			sleep_tail_us;
+	long			monitors;
+	t_fork_mode		forks;
+	t_engine		engine;
+	long			seed;
+	char			*death_log;
+	int				stats;
+	t_trace			trace;
+	t_sink_mode		sink;
+	long			clock_tick_us;
+	char			*join_log;
+	long			stack_kib;
+	t_huge_mode		hugepages;
+}	t_options;
+
+typedef struct s_optdef
+{
+	const char	*name;
+	int			(*parse)(t_options *opt, char *val);
+}	t_optdef;
+
+/*
+** One log record. ts is captured when the event happens, seq keeps the
+** per-ring order for events that share the same millisecond.
+*/
+typedef struct s_event
+{
+	t_nsec			ts;
+	int				id;
+	unsigned int	seq;
+	t_state			state;
+}	t_event;
+
+/*
+** Status text of a log line with its length, so the formatter copies it
+** without scanning for the terminator.
+*/
+typedef struct s_status_str
+{
+	const char	*str;
+	size_t		len;
+}	t_status_str;
+
+/*
+** Single-producer/single-consumer ring. Only the owning thread advances
+** head, only the writer thread advances tail. busy is raised while the
+** producer is between its simulation check and publishing the slot.
+*/
+typedef struct s_ring
+{
+	t_event			slots[LOG_RING_SIZE];
+	atomic_ulong	head;
+	atomic_ulong	tail;
+	atomic_int		busy;
+	atomic_ulong	dropped;
+}	t_ring;
+
+/*
+** Kernel-shared io_uring rings, set up with raw syscalls. At most one write
+** is in flight: inflight bytes of pending, with spare holding the buffer
+** the logger formats into next. failed stops any further submission.
+*/
+typedef struct s_uring
+{
+	int					fd;
+	char				*sq;
+	char				*cq;
+	size_t				sq_len;
+	size_t				cq_len;
+	struct io_uring_sqe	*sqes;
+	atomic_uint			*sq_tail;
+	unsigned int		*sq_mask;
+	unsigned int		*sq_array;
+	atomic_uint			*cq_head;
+	atomic_uint			*cq_tail;
+	unsigned int		*cq_mask;
+	struct io_uring_cqe	*cqes;
+	unsigned int		sq_entries;
+	char				*spare;
+	char				*pending;
+	size_t				inflight;
+	int					failed;
+}	t_uring;
+
+/*
+** Backend state of the output sink. writev parks full buffers from pool in
+** iov until the next tick. mmap copies into a shared mapping of stdout
+** through map_fd, a read-write reopening of stdout; map starts at file
+** offset map_off, the output at map + base, and written bytes of it are
+** done. file_len is the current size of the file.
+*/
+typedef struct s_sink_state
+{
+	char			*pool[LOG_IOV_MAX];
+	struct iovec	iov[LOG_IOV_MAX];
+	int				parked;
+	char			*map;
+	int				map_fd;
+	size_t			map_len;
+	off_t			map_off;
+	size_t			base;
+	off_t			file_len;
+	size_t			written;
+	t_uring			ring;
+}	t_sink_state;
+
+typedef struct s_logger	t_logger;
+
+/*
+** An output backend, picked with --sink. flush hands over log->buf[0..len)
+** and leaves log->len at 0, full is set when the buffer ran out of room
+** rather than at a tick or at the end. open and close may be NULL.
+*/
+typedef struct s_sink
+{
+	const char	*name;
+	int			(*open)(t_logger *log);
+	void		(*flush)(t_logger *log, int full);
+	void		(*close)(t_logger *log);
+}	t_sink;
+
+typedef struct s_logger
+{
+	t_ring			*rings;
+	atomic_ulong	*dirty;
+	int				nrings;
+	pthread_t		thread;
+	t_event			*stage;
+	size_t			staged;
+	size_t			capacity;
+	char			*buf;
+	size_t			len;
+	atomic_int		done;
+	int				stopped;
+	int64_t			trace_us;
+	const t_sink	*sink;
+	t_sink_state	out;
+}	t_logger;
+
+/*
+** The state a philosopher writes on every meal and its monitor reads, one
+** cache line per philosopher, so a meal never invalidates a neighbour's
+** line or the read-only t_philo fields.
+*/
+typedef struct s_philo_hot
+{
+	_Alignas(CACHE_LINE) _Atomic t_nsec	last_meal;
+	atomic_int							meals_eaten;
+	int									eating;
+}	t_philo_hot;
+
+/*
+** Where a philosopher's forks sit in the futex backend's block words:
+** one word and a two-bit mask, or, for a seat whose forks straddle two
+** blocks, one bit in each, the lower fork's word first.
+*/
+typedef struct s_seat
+{
+	atomic_int	*word[2];
+	int			mask[2];
+	int			words;
+}	t_seat;
+
+/*
+** The futex backend's hungry flag, which the neighbours write too: they
+** raise it to 2 before sleeping on it and futex_stop() clears it. It
+** gets a line of its own so those writes never hit the line last_meal
+** is published on. spin is the owner's spin estimate and seat its fork
+** bits, used on the same path.
+*/
+typedef struct s_hunger
+{
+	_Alignas(CACHE_LINE) atomic_int	hungry;
+	int								spin;
+	t_seat							seat;
+}	t_hunger;
+
+/*
+** FORK_BLOCK forks of the futex backend in one futex word: bit f is fork
+** f held, bit FORK_WAITERS + f a neighbour parked on it, and FORK_STOP is
+** set once the run has ended.
+*/
+typedef struct s_fork_block
+{
+	_Alignas(CACHE_LINE) atomic_int	word;
+}	t_fork_block;
+
+/*
+** A fork alone on its cache line: the mutex of the mutex-based strategies
+** and the next/serving counters of the ticket strategy.
+*/
+typedef struct s_fork
+{
+	_Alignas(CACHE_LINE) pthread_mutex_t	lock;
+	atomic_int								next;
+	atomic_int								serving;
+}	t_fork;
+
+/*
+** Chandy-Misra state of a fork, guarded by the lock of the matching
+** t_fork. owner is the index of the philosopher holding it; a dirty fork
+** goes to a neighbour that asks unless its owner is eating.
+*/
+typedef struct s_cm_fork
+{
+	_Alignas(CACHE_LINE) pthread_cond_t	cond;
+	int									owner;
+	int									dirty;
+}	t_cm_fork;
+
+/*
+** Read-only once the simulation starts: thread and children are filled
+** in by the spawn tree before the start barrier opens, and the state
+** that changes during the run lives in hot and hunger.
+*/
 typedef struct s_philo
 {
 	int				id;
+	int				shard;
 	pthread_t		thread;
+	int				children;
 	pthread_mutex_t	*fork_left;
 	pthread_mutex_t	*fork_right;
-	long			last_meal;
+	t_philo_hot		*hot;
+	t_hunger		*hunger;
 	t_table			*table;
-	int				meals_eaten;
 }	t_philo;
 
+/*
+** A fork protocol, picked with --forks. acquire returns 1 holding both
+** forks with the two fork lines printed, or 0 holding none once the run
+** has ended. release puts them down, on_think runs as the philosopher
+** starts thinking, stop wakes every philosopher blocked in acquire when
+** the run ends. init, free, on_think and stop may be NULL.
+*/
+typedef struct s_strategy
+{
+	const char	*name;
+	int			(*init)(t_table *table);
+	void		(*free)(t_table *table);
+	void		(*on_think)(t_philo *philo, t_table *table);
+	int			(*acquire)(t_philo *philo, t_table *table);
+	void		(*release)(t_philo *philo, t_table *table);
+	void		(*stop)(t_table *table);
+}	t_strategy;
+
+/*
+** Waiter that hands out fork pairs in earliest-deadline-first order.
+** pending holds hungry philosophers keyed by last_meal + die_ns; busy and
+** reserved are per fork, granted[i] is the futex philosopher i sleeps on.
+*/
+typedef struct s_arbiter
+{
+	pthread_mutex_t	lock;
+	t_heap			pending;
+	t_heap_node		*scratch;
+	char			*busy;
+	char			*reserved;
+	atomic_int		*granted;
+}	t_arbiter;
+
+/*
+** Discrete-event engine state, one entry per philosopher in each array.
+** Times are virtual microseconds. events holds the single pending wakeup
+** of every philosopher that is not blocked on a fork, deaths holds every
+** death deadline; both are keyed by des_key() so ties resolve by id.
+*/
+typedef struct s_des
+{
+	long		vt;
+	t_heap		events;
+	t_heap		deaths;
+	long		*last_meal;
+	int			*meals;
+	char		*phase;
+	int			*owner;
+	int			*waiter;
+	int			full;
+	uint64_t	rng;
+}	t_des;
+
+/*
+** Saved execution state of a task or of a worker's scheduler loop: the
+** stack pointer for the hand-rolled x86-64 switch, a full ucontext on
+** every other architecture.
+*/
+# if defined(__x86_64__)
+
+typedef void			*t_task_ctx;
+# else
+
+typedef ucontext_t		t_task_ctx;
+# endif
+
+/*
+** Fork of the task engine. state is 0 when free, 1 when held and 2 when
+** held with waiter parked on it; a release with a waiter hands the fork
+** over without ever making it free.
+*/
+typedef struct s_task_fork
+{
+	_Alignas(CACHE_LINE) atomic_int	state;
+	struct s_task					*waiter;
+}	t_task_fork;
+
+/*
+** A philosopher running as a coroutine. worker is the pool thread that
+** currently runs it and is rewritten on every resume, since stealing and
+** fork hand-offs move tasks between workers.
+*/
+typedef struct s_task
+{
+	t_task_ctx			ctx;
+	t_philo				*philo;
+	struct s_worker		*worker;
+	int					started;
+	t_park				park;
+	t_nsec				wake;
+	t_task_fork			*want;
+}	t_task;
+
+/*
+** Run queue of one worker. The owner pushes at tail and pops at head,
+** thieves take from tail. Every task is in at most one queue, so cap is
+** the number of philosophers and the ring never overflows.
+*/
+typedef struct s_deque
+{
+	pthread_mutex_t	lock;
+	t_task			**slots;
+	long			cap;
+	long			head;
+	long			tail;
+}	t_deque;
+
+/*
+** Worker thread of the task pool. sched is the context tasks switch back
+** to; timers holds the tasks sleeping on this worker keyed by wake time.
+*/
+typedef struct s_worker
+{
+	struct s_pool	*pool;
+	pthread_t		thread;
+	int				index;
+	t_task_ctx		sched;
+	t_deque			ready;
+	t_heap			timers;
+}	t_worker;
+
+/*
+** M:N pool: one task per philosopher on cpu_count() workers. stacks is
+** one mapping carved into TASK_STACK_SIZE slices. signal is the futex
+** idle workers sleep on; it is bumped when work appears and idle > 0,
+** and by pool_stop() when the run ends.
+*/
+typedef struct s_pool
+{
+	t_table			*table;
+	t_task			*tasks;
+	t_task_fork		*forks;
+	char			*stacks;
+	size_t			stacks_len;
+	t_worker		*workers;
+	int				nworkers;
+	int				started;
+	atomic_int		live;
+	atomic_int		idle;
+	atomic_int		signal;
+}	t_pool;
+
+/*
+** Log-linear histogram of nanosecond values: exact below HIST_SUB, then
+** HIST_SUB buckets per power of two (about 6% wide) up to 2^HIST_MAX_EXP
+** (68 s). Only the owning philosopher writes it, readers merge with plain
+** relaxed loads.
+*/
+typedef struct s_hist
+{
+	atomic_uint	count[HIST_BUCKETS];
+}	t_hist;
+
+/* One philosopher's histograms and the smallest slack it ever had */
+typedef struct s_philo_stats
+{
+	_Alignas(CACHE_LINE) t_hist	h[STAT_COUNT];
+	_Atomic t_nsec				min_slack;
+}	t_philo_stats;
+
+/* --stats=on state: philo is NULL when off */
+typedef struct s_stats
+{
+	t_philo_stats	*philo;
+}	t_stats;
+
+/*
+** One flight-recorder entry, guarded by its own seqlock: seq is odd while
+** the owning philosopher rewrites ts and state, and 0 until first used.
+*/
+typedef struct s_flight_slot
+{
+	atomic_uint		seq;
+	atomic_int		state;
+	_Atomic t_nsec	ts;
+}	t_flight_slot;
+
+/*
+** The last FLIGHT_EVENTS state changes of one philosopher. Only the owner
+** writes it, so head needs no atomics; readers order slots by ts.
+*/
+typedef struct s_flight
+{
+	_Alignas(CACHE_LINE) t_flight_slot	slots[FLIGHT_EVENTS];
+	unsigned long						head;
+}	t_flight;
+
+/*
+** Thread taking SIGUSR1 (flight-recorder dump) and SIGUSR2 (--stats
+** report) with sigwait(); done tells it the next signal is the last.
+*/
+typedef struct s_signals
+{
+	pthread_t	thread;
+	int			running;
+	atomic_int	done;
+}	t_signals;
+
+/*
+** Start barrier: threads count themselves in arrived and sleep on open
+** until the epoch is published. skew is how long after the epoch the
+** last of them got past it. failed is set when a thread could not be
+** created; its subtree is counted in arrived so the barrier still fills.
+*/
+typedef struct s_start
+{
+	atomic_int		arrived;
+	atomic_int		expected;
+	atomic_int		open;
+	atomic_int		failed;
+	_Atomic t_nsec	skew;
+}	t_start;
+
+/* The mapping that holds the table itself, see arena.c */
+typedef struct s_arena
+{
+	size_t		len;
+	t_huge_mode	huge;
+}	t_arena;
+
+/*
+** Philosopher thread creation: the --stack-size attributes, whether the
+** root of the spawn tree was created, how long it took from the first
+** pthread_create() to the epoch and the process VSZ/RSS just after.
+*/
+typedef struct s_spawn
+{
+	pthread_attr_t	attr;
+	int				has_attr;
+	int				root;
+	t_nsec			ns;
+	long			vsz_kib;
+	long			rss_kib;
+}	t_spawn;
+
+/*
+** Timeline of the death that ended the run: deadline is last_meal plus
+** time_to_die, detected is when the monitor saw it and printed is when the
+** write() carrying the "died" line returned. Zero when nobody died.
+*/
+typedef struct s_death
+{
+	t_nsec	deadline;
+	t_nsec	detected;
+	t_nsec	printed;
+}	t_death;
+
+/*
+** A monitor watches philo[first .. first + count - 1]. Its heap holds one
+** death deadline (last_meal + die_ns) per philosopher. die_ns is one
+** millisecond past time_to_die: dead means more than time_to_die whole
+** milliseconds elapsed, the same granularity the log uses.
+** wake is the futex word the monitor sleeps on: it is loaded before the
+** deadlines are checked and bumped by every publisher (a philosopher
+** getting full, the end of the run), so an event between the check and
+** the sleep makes the sleep return at once.
+*/
+typedef struct s_monitor
+{
+	t_table		*table;
+	pthread_t	thread;
+	int			first;
+	int			count;
+	t_nsec		next;
+	atomic_int	wake;
+	t_heap		heap;
+}	t_monitor;
+
 typedef struct s_table
 {
-	int				num_philos;
-	long			time_to_die;
-	long			time_to_eat;
-	long			time_to_sleep;
-	long			start;
-	int				simulation;
-	int				meals_required;
-	pthread_mutex_t	*forks;
-	pthread_mutex_t	print_mutex;
-	t_philo			*philo;
-	pthread_mutex_t	data_mutex;
+	t_arena				arena;
+	int					num_philos;
+	long				time_to_die;
+	long				time_to_eat;
+	long				time_to_sleep;
+	t_nsec				die_ns;
+	t_nsec				start;
+	atomic_int			simulation;
+	t_nsec				stop_at;
+	int					meals_required;
+	t_fork				*forks;
+	int					forks_ready;
+	t_philo				*philo;
+	t_philo_hot			*hot;
+	t_hunger			*hunger;
+	t_options			opt;
+	t_logger			log;
+	t_monitor			*monitors;
+	const t_strategy	*strategy;
+	t_arbiter			arbiter;
+	t_cm_fork			*cm;
+	t_fork_block		*blocks;
+	sem_t				seats;
+	t_des				*des;
+	t_pool				*pool;
+	int					num_monitors;
+	atomic_int			full_count;
+	t_death				death;
+	t_start				gate;
+	t_spawn				spawn;
+	t_stats				stats;
+	t_flight			*flight;
+	t_signals			signals;
 }	t_table;
 
 #endif
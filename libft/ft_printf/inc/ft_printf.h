@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 17:25:58 by ccavalca          #+#    #+#             */
-/*   Updated: 2025/08/14 21:08:19 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,25 +17,75 @@
 # include <stdlib.h>
 # include <stddef.h>
 # include <unistd.h>
+# include <stdatomic.h>
+# include <sched.h>
+
+/*
+** Output is staged in one buffer per descriptor below PF_FD_MAX and only
+** reaches write(2) when that buffer fills, on ft_printf_flush() or at
+** exit. fd 2 keeps stderr semantics and is flushed at the end of every
+** call; descriptors past PF_FD_MAX use a per-call buffer.
+*/
+# define PF_BUF_SIZE 4096
+# define PF_FD_MAX 16
+
+typedef struct s_pf_fdbuf
+{
+	atomic_flag	lock;
+	size_t		len;
+	char		data[PF_BUF_SIZE];
+}	t_pf_fdbuf;
+
+/*
+** Destination of one formatting pass. fd == -1 is the ft_snprintf mode:
+** output past cap is dropped but still counted in total.
+*/
+typedef struct s_pf_out
+{
+	char	*buf;
+	size_t	cap;
+	size_t	len;
+	size_t	total;
+	int		fd;
+}	t_pf_out;
+
+/*
+** One conversion: flags '-' and '0', a field width and the length
+** modifier ('l', 'L' for ll, 'z' or 0).
+*/
+typedef struct s_pf_spec
+{
+	int			minus;
+	int			zero;
+	size_t		width;
+	char		length;
+	char		conv;
+	const char	*prefix;
+}	t_pf_spec;
 
 //ft_printf
-int	ft_printf(const char *format, ...);
+int			ft_printf(const char *format, ...);
+int			ft_dprintf(int fd, const char *format, ...);
+int			ft_vdprintf(int fd, const char *format, va_list args);
+int			ft_snprintf(char *str, size_t size, const char *format, ...);
+void		ft_printf_flush(int fd);
+
+// buffers
+t_pf_fdbuf	*pf_lock(int fd);
+void		pf_unlock(t_pf_fdbuf *b);
+void		pf_write(int fd, const char *buf, size_t len);
 
 // utils
-int	ft_putchar(char c);
-int	ft_putstr(char *str);
-int	ft_putnbr(int nb);
-int	ft_putnbr_un(unsigned int n);
-int	ft_puthex(unsigned long n, const char *base);
+int			pf_format(t_pf_out *out, const char *format, va_list *args);
+void		pf_put(t_pf_out *out, const char *s, size_t n);
+void		pf_field(t_pf_out *out, t_pf_spec *spec, const char *s, size_t n);
+char		*pf_utoa(unsigned long long n, const char *base, char *end);
 
 // specifiers
-int	print_c(va_list args);
-int	print_s(va_list args);
-int	print_p(va_list args);
-int	print_d(va_list args);
-int	print_i(va_list args);
-int	print_u(va_list args);
-int	print_x(va_list args);
-int	print_x_upper(va_list args);
-
-#endif
\ No newline at end of file
+void		print_c(t_pf_out *out, t_pf_spec *spec, va_list *args);
+void		print_s(t_pf_out *out, t_pf_spec *spec, va_list *args);
+void		print_p(t_pf_out *out, t_pf_spec *spec, va_list *args);
+void		print_d(t_pf_out *out, t_pf_spec *spec, va_list *args);
+void		print_u(t_pf_out *out, t_pf_spec *spec, va_list *args);
+
+#endif
@@ -6,57 +6,88 @@
 /*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 17:02:10 by ccavalca          #+#    #+#             */
-/*   Updated: 2025/08/14 21:01:07 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf.h"
 
-int	which_specifier(char specifier, va_list args)
+static void	out_init(t_pf_out *out, char *buf, size_t len, int fd)
 {
-	if (specifier == 'c')
-		return (print_c(args));
-	else if (specifier == 's')
-		return (print_s(args));
-	else if (specifier == 'p')
-		return (print_p(args));
-	else if (specifier == 'd')
-		return (print_d(args));
-	else if (specifier == 'i')
-		return (print_i(args));
-	else if (specifier == 'u')
-		return (print_u(args));
-	else if (specifier == 'x')
-		return (print_x(args));
-	else if (specifier == 'X')
-		return (print_x_upper(args));
-	else if (specifier == '%')
-		return (ft_putchar('%'));
-	return (0);
+	out->buf = buf;
+	out->cap = PF_BUF_SIZE;
+	out->len = len;
+	out->total = 0;
+	out->fd = fd;
 }
 
-int	ft_printf(const char *print, ...)
+int	ft_vdprintf(int fd, const char *format, va_list args)
 {
-	va_list	args;
-	int		i;
-	int		count;
+	t_pf_fdbuf	*b;
+	t_pf_out	out;
+	char		local[PF_BUF_SIZE];
+	va_list		copy;
 
-	va_start(args, print);
-	i = 0;
-	count = 0;
-	while (print[i])
+	b = pf_lock(fd);
+	if (b)
+		out_init(&out, b->data, b->len, fd);
+	else
+		out_init(&out, local, 0, fd);
+	va_copy(copy, args);
+	pf_format(&out, format, &copy);
+	va_end(copy);
+	if (!b || fd == 2)
+	{
+		pf_write(fd, out.buf, out.len);
+		out.len = 0;
+	}
+	if (b)
 	{
-		if (print[i] == '%' && print[i + 1] != '\0')
-		{
-			i++;
-			count += which_specifier(print[i], args);
-		}
-		else
-		{
-			count += ft_putchar(print[i]);
-		}
-		i++;
+		b->len = out.len;
+		pf_unlock(b);
 	}
+	return ((int)out.total);
+}
+
+int	ft_printf(const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vdprintf(1, format, args);
 	va_end(args);
 	return (count);
 }
+
+int	ft_dprintf(int fd, const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vdprintf(fd, format, args);
+	va_end(args);
+	return (count);
+}
+
+/*
+** Formats into str without any syscall, truncating to size - 1 bytes
+** plus the terminator; returns the length the full output would have.
+*/
+int	ft_snprintf(char *str, size_t size, const char *format, ...)
+{
+	t_pf_out	out;
+	va_list		args;
+
+	out_init(&out, str, 0, -1);
+	out.cap = 0;
+	if (size > 0)
+		out.cap = size - 1;
+	va_start(args, format);
+	pf_format(&out, format, &args);
+	va_end(args);
+	if (size > 0)
+		str[out.len] = '\0';
+	return ((int)out.total);
+}
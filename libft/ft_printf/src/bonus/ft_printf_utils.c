@@ -6,68 +6,101 @@
 /*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 17:15:26 by ccavalca          #+#    #+#             */
-/*   Updated: 2025/08/14 21:06:45 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf.h"
 
-int	ft_putchar(char c)
+/*
+** Appends n bytes to out. A full descriptor buffer is written out and
+** reused; a full caller buffer (fd == -1) drops the rest, which is still
+** counted so ft_snprintf can report the length it wanted.
+*/
+void	pf_put(t_pf_out *out, const char *s, size_t n)
 {
-	write(1, &c, 1);
-	return (1);
-}
-
-int	ft_putstr(char *str)
-{
-	int	i;
+	size_t	room;
+	size_t	i;
 
-	i = 0;
-	if (!str)
-		str = "(null)";
-	while (str[i])
-		i += ft_putchar(str[i]);
-	return (i);
+	out->total += n;
+	while (n > 0)
+	{
+		if (out->len == out->cap && out->fd < 0)
+			return ;
+		if (out->len == out->cap)
+		{
+			pf_write(out->fd, out->buf, out->len);
+			out->len = 0;
+		}
+		room = out->cap - out->len;
+		if (room > n)
+			room = n;
+		i = 0;
+		while (i < room)
+			out->buf[out->len++] = s[i++];
+		s += room;
+		n -= room;
+	}
 }
 
-int	ft_putnbr(int nb)
+static void	pf_pad(t_pf_out *out, char c, size_t n)
 {
-	long	n;
-	int		count;
+	static const char	spaces[] = "                ";
+	static const char	zeros[] = "0000000000000000";
+	const char			*run;
 
-	n = nb;
-	count = 0;
-	if (n < 0)
+	run = spaces;
+	if (c == '0')
+		run = zeros;
+	while (n > 16)
 	{
-		count += ft_putchar('-');
-		n = -n;
+		pf_put(out, run, 16);
+		n -= 16;
 	}
-	if (n >= 10)
-		count += ft_putnbr(n / 10);
-	count += ft_putchar((n % 10) + '0');
-	return (count);
+	pf_put(out, run, n);
 }
 
-int	ft_putnbr_un(unsigned int n)
+/*
+** Emits spec->prefix and the n bytes of s padded to spec->width: spaces
+** before (or after with '-'), zeros between the prefix and the digits.
+*/
+void	pf_field(t_pf_out *out, t_pf_spec *spec, const char *s, size_t n)
 {
-	int	count;
+	size_t	plen;
+	size_t	pad;
 
-	count = 0;
-	if (n >= 10)
-		count += ft_putnbr_un(n / 10);
-	count += ft_putchar((n % 10) + '0');
-	return (count);
+	plen = 0;
+	while (spec->prefix[plen])
+		plen++;
+	pad = 0;
+	if (spec->width > plen + n)
+		pad = spec->width - plen - n;
+	if (!spec->minus && !spec->zero)
+		pf_pad(out, ' ', pad);
+	pf_put(out, spec->prefix, plen);
+	if (!spec->minus && spec->zero)
+		pf_pad(out, '0', pad);
+	pf_put(out, s, n);
+	if (spec->minus)
+		pf_pad(out, ' ', pad);
 }
 
-int	ft_puthex(unsigned long n, const char *base)
+/*
+** Writes the digits of n backwards ending at end and returns the first.
+*/
+char	*pf_utoa(unsigned long long n, const char *base, char *end)
 {
-	int	count;
+	unsigned int	radix;
 
-	count = 0;
-	if (n >= 16)
+	radix = 0;
+	while (base[radix])
+		radix++;
+	*--end = base[n % radix];
+	n /= radix;
+	while (n > 0)
 	{
-		count += ft_puthex(n / 16, base);
+		*--end = base[n % radix];
+		n /= radix;
 	}
-	count += ft_putchar(base[n % 16]);
-	return (count);
+	return (end);
 }
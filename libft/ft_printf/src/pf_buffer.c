@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pf_buffer.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:11:35 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf.h"
+
+void	pf_write(int fd, const char *buf, size_t len)
+{
+	ssize_t	ret;
+
+	while (len > 0)
+	{
+		ret = write(fd, buf, len);
+		if (ret <= 0)
+			return ;
+		buf += ret;
+		len -= ret;
+	}
+}
+
+static void	flush_all(void)
+{
+	ft_printf_flush(-1);
+}
+
+/*
+** Locks and returns the buffer of fd, or NULL when fd has none. The
+** first call registers the at-exit flush.
+*/
+t_pf_fdbuf	*pf_lock(int fd)
+{
+	static t_pf_fdbuf	bufs[PF_FD_MAX];
+	static atomic_flag	registered = ATOMIC_FLAG_INIT;
+	t_pf_fdbuf			*b;
+
+	if (!atomic_flag_test_and_set(&registered))
+		atexit(flush_all);
+	if (fd < 0 || fd >= PF_FD_MAX)
+		return (NULL);
+	b = &bufs[fd];
+	while (atomic_flag_test_and_set_explicit(&b->lock, memory_order_acquire))
+		sched_yield();
+	return (b);
+}
+
+void	pf_unlock(t_pf_fdbuf *b)
+{
+	atomic_flag_clear_explicit(&b->lock, memory_order_release);
+}
+
+/*
+** Writes out what ft_printf/ft_dprintf staged for fd, or for every
+** descriptor when fd is -1.
+*/
+void	ft_printf_flush(int fd)
+{
+	t_pf_fdbuf	*b;
+
+	if (fd == -1)
+	{
+		fd = 0;
+		while (fd < PF_FD_MAX)
+			ft_printf_flush(fd++);
+		return ;
+	}
+	b = pf_lock(fd);
+	if (!b)
+		return ;
+	pf_write(fd, b->data, b->len);
+	b->len = 0;
+	pf_unlock(b);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pf_format.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:11:35 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf.h"
+
+static const char	*parse_spec(const char *f, t_pf_spec *spec)
+{
+	spec->minus = 0;
+	spec->zero = 0;
+	spec->width = 0;
+	spec->length = 0;
+	spec->prefix = "";
+	while (*f == '-' || *f == '0')
+	{
+		if (*f == '-')
+			spec->minus = 1;
+		else
+			spec->zero = 1;
+		f++;
+	}
+	while (*f >= '0' && *f <= '9')
+		spec->width = spec->width * 10 + (*f++ - '0');
+	if (f[0] == 'l' && f[1] == 'l')
+	{
+		spec->length = 'L';
+		f += 2;
+	}
+	else if (*f == 'l' || *f == 'z')
+		spec->length = *f++;
+	spec->conv = *f;
+	return (f);
+}
+
+static void	convert(t_pf_out *out, t_pf_spec *spec, va_list *args)
+{
+	if (spec->conv == 'c')
+		print_c(out, spec, args);
+	else if (spec->conv == 's')
+		print_s(out, spec, args);
+	else if (spec->conv == 'p')
+		print_p(out, spec, args);
+	else if (spec->conv == 'd' || spec->conv == 'i')
+		print_d(out, spec, args);
+	else if (spec->conv == 'u' || spec->conv == 'x' || spec->conv == 'X')
+		print_u(out, spec, args);
+	else if (spec->conv == '%')
+		pf_field(out, spec, "%", 1);
+}
+
+/*
+** Copies literal runs in one pf_put each and expands every
+** %[-0][width][l|ll|z]conv; unknown conversions print nothing.
+*/
+int	pf_format(t_pf_out *out, const char *format, va_list *args)
+{
+	const char	*start;
+	t_pf_spec	spec;
+
+	while (*format)
+	{
+		start = format;
+		while (*format && (*format != '%' || !format[1]))
+			format++;
+		pf_put(out, start, format - start);
+		if (!*format)
+			break ;
+		format = parse_spec(format + 1, &spec);
+		if (!*format)
+			break ;
+		convert(out, &spec, args);
+		format++;
+	}
+	return ((int)out->total);
+}
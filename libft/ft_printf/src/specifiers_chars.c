@@ -6,39 +6,38 @@
 /*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 19:11:17 by ccavalca          #+#    #+#             */
-/*   Updated: 2025/08/14 20:54:59 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf.h"
 
-int	print_c(va_list args)
+static size_t	pf_strlen(const char *s)
 {
-	char	c;
+	size_t	n;
 
-	c = (char)va_arg(args, int);
-	return (ft_putchar(c));
+	n = 0;
+	while (s[n])
+		n++;
+	return (n);
 }
 
-int	print_s(va_list args)
+void	print_c(t_pf_out *out, t_pf_spec *spec, va_list *args)
 {
-	char	*s;
+	char	c;
 
-	s = va_arg(args, char *);
-	if (!s)
-		return (ft_putstr("(null)"));
-	return (ft_putstr(s));
+	c = (char)va_arg(*args, int);
+	spec->zero = 0;
+	pf_field(out, spec, &c, 1);
 }
 
-int	print_d(va_list args)
+void	print_s(t_pf_out *out, t_pf_spec *spec, va_list *args)
 {
-	int	n;
-
-	n = va_arg(args, int);
-	return (ft_putnbr(n));
-}
+	char	*s;
 
-int	print_i(va_list args)
-{
-	return (print_d(args));
+	s = va_arg(*args, char *);
+	if (!s)
+		s = "(null)";
+	spec->zero = 0;
+	pf_field(out, spec, s, pf_strlen(s));
 }
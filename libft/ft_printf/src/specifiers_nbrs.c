@@ -6,46 +6,84 @@
 /*   By: ccavalca <ccavalca@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 19:11:20 by ccavalca          #+#    #+#             */
-/*   Updated: 2025/08/14 21:09:58 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf.h"
 
-int	print_p(va_list args)
+/*
+** Room for a 64-bit value in base 10 plus sign, or in base 16.
+*/
+#define PF_DIGITS 24
+
+static long long	get_signed(t_pf_spec *spec, va_list *args)
 {
-	void			*ptr;
-	int				count;
+	if (spec->length == 'L')
+		return (va_arg(*args, long long));
+	if (spec->length == 'l')
+		return (va_arg(*args, long));
+	if (spec->length == 'z')
+		return (va_arg(*args, ssize_t));
+	return (va_arg(*args, int));
+}
 
-	ptr = va_arg(args, void *);
-	if (!ptr)
-		return (ft_putstr("(nil)"));
-	count = 0;
-	count += ft_putstr("0x");
-	count += ft_puthex((unsigned long)ptr, "0123456789abcdef");
-	return (count);
+static unsigned long long	get_unsigned(t_pf_spec *spec, va_list *args)
+{
+	if (spec->length == 'L')
+		return (va_arg(*args, unsigned long long));
+	if (spec->length == 'l')
+		return (va_arg(*args, unsigned long));
+	if (spec->length == 'z')
+		return (va_arg(*args, size_t));
+	return (va_arg(*args, unsigned int));
 }
 
-int	print_u(va_list args)
+void	print_p(t_pf_out *out, t_pf_spec *spec, va_list *args)
 {
-	unsigned int	n;
+	void	*ptr;
+	char	digits[PF_DIGITS];
+	char	*start;
 
-	n = va_arg(args, unsigned int);
-	return (ft_putnbr_un(n));
+	ptr = va_arg(*args, void *);
+	spec->zero = 0;
+	if (!ptr)
+		return (pf_field(out, spec, "(nil)", 5));
+	start = pf_utoa((unsigned long)ptr, "0123456789abcdef",
+			digits + PF_DIGITS);
+	spec->prefix = "0x";
+	pf_field(out, spec, start, digits + PF_DIGITS - start);
 }
 
-int	print_x(va_list args)
+void	print_d(t_pf_out *out, t_pf_spec *spec, va_list *args)
 {
-	unsigned int	n;
+	long long			n;
+	unsigned long long	u;
+	char				digits[PF_DIGITS];
+	char				*start;
 
-	n = va_arg(args, unsigned int);
-	return (ft_puthex(n, "0123456789abcdef"));
+	n = get_signed(spec, args);
+	u = n;
+	if (n < 0)
+	{
+		u = -u;
+		spec->prefix = "-";
+	}
+	start = pf_utoa(u, "0123456789", digits + PF_DIGITS);
+	pf_field(out, spec, start, digits + PF_DIGITS - start);
 }
 
-int	print_x_upper(va_list args)
+void	print_u(t_pf_out *out, t_pf_spec *spec, va_list *args)
 {
-	unsigned int	n;
+	const char	*base;
+	char		digits[PF_DIGITS];
+	char		*start;
 
-	n = va_arg(args, unsigned int);
-	return (ft_puthex(n, "0123456789ABCDEF"));
+	base = "0123456789";
+	if (spec->conv == 'x')
+		base = "0123456789abcdef";
+	else if (spec->conv == 'X')
+		base = "0123456789ABCDEF";
+	start = pf_utoa(get_unsigned(spec, args), base, digits + PF_DIGITS);
+	pf_field(out, spec, start, digits + PF_DIGITS - start);
 }
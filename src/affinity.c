@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   affinity.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:21:35 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:58:35 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	cpu_count(void)
+{
+	long	n;
+
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1)
+		return (1);
+	return ((int)n);
+}
+
+/*
+** Shard k of K owns cores [k * ncpu / K, (k + 1) * ncpu / K). The calling
+** thread (its monitor or one of its philosophers) is restricted to them so
+** a monitor reads last_meal from caches close to the writers.
+*/
+void	pin_to_shard(t_table *table, int shard)
+{
+	cpu_set_t	set;
+	int			ncpu;
+	int			cpu;
+	int			end;
+
+	if (table->num_monitors < 2)
+		return ;
+	ncpu = cpu_count();
+	cpu = (long)shard * ncpu / table->num_monitors;
+	end = (long)(shard + 1) * ncpu / table->num_monitors;
+	if (end <= cpu)
+		end = cpu + 1;
+	CPU_ZERO(&set);
+	while (cpu < end)
+	{
+		CPU_SET(cpu % ncpu, &set);
+		cpu++;
+	}
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/*
+** Spin budget derived from the running average of spins a wait took, like
+** glibc's adaptive mutex: twice the average plus a floor, capped.
+*/
+int	spin_budget(int average)
+{
+	if (average * 2 + 10 > FORK_SPIN_MAX)
+		return (FORK_SPIN_MAX);
+	return (average * 2 + 10);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+void	cpu_relax(void)
+{
+	__builtin_ia32_pause();
+}
+
+#else
+
+void	cpu_relax(void)
+{
+}
+
+#endif
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arbiter.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:22:21 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static void	grant_or_reserve(t_table *table, t_arbiter *arb, t_heap_node *node)
+{
+	int	l;
+	int	r;
+
+	l = node->item;
+	r = (l + 1) % table->num_philos;
+	if (!arb->busy[l] && !arb->busy[r] && !arb->reserved[l]
+		&& !arb->reserved[r])
+	{
+		arb->busy[l] = 1;
+		arb->busy[r] = 1;
+		atomic_store_explicit(&arb->granted[l], 1, memory_order_release);
+		futex_wake(&arb->granted[l], 1);
+	}
+	else
+	{
+		arb->reserved[l] = 1;
+		arb->reserved[r] = 1;
+		heap_push(&arb->pending, l, node->key);
+	}
+}
+
+/*
+** Walks the pending philosophers in deadline order. A pair is granted only
+** if both forks are free and not reserved by someone closer to dying;
+** otherwise the forks are reserved so later deadlines cannot take them.
+** Called with the arbiter lock held.
+*/
+static void	dispatch(t_table *table, t_arbiter *arb)
+{
+	int	n;
+	int	i;
+
+	n = 0;
+	while (arb->pending.size > 0)
+	{
+		arb->scratch[n] = arb->pending.nodes[0];
+		heap_pop(&arb->pending);
+		n++;
+	}
+	i = 0;
+	while (i < n)
+	{
+		grant_or_reserve(table, arb, &arb->scratch[i]);
+		i++;
+	}
+	i = 0;
+	while (i < n)
+	{
+		arb->reserved[arb->scratch[i].item] = 0;
+		arb->reserved[(arb->scratch[i].item + 1) % table->num_philos] = 0;
+		i++;
+	}
+}
+
+int	arbiter_take(t_philo *philo, t_table *table)
+{
+	t_arbiter	*arb;
+	int			i;
+
+	arb = &table->arbiter;
+	i = philo->id - 1;
+	pthread_mutex_lock(&arb->lock);
+	heap_push(&arb->pending, i, atomic_load_explicit(&philo->hot->last_meal,
+			memory_order_relaxed) + table->die_ns);
+	dispatch(table, arb);
+	pthread_mutex_unlock(&arb->lock);
+	while (!atomic_load_explicit(&arb->granted[i], memory_order_acquire))
+		futex_wait(&arb->granted[i], 0);
+	if (atomic_exchange(&arb->granted[i], 0) == ARBITER_STOP)
+		return (0);
+	print_status(table, philo->id, ST_FORK);
+	print_status(table, philo->id, ST_FORK);
+	return (1);
+}
+
+void	arbiter_drop(t_philo *philo, t_table *table)
+{
+	t_arbiter	*arb;
+	int			i;
+
+	arb = &table->arbiter;
+	i = philo->id - 1;
+	pthread_mutex_lock(&arb->lock);
+	arb->busy[i] = 0;
+	arb->busy[(i + 1) % table->num_philos] = 0;
+	dispatch(table, arb);
+	pthread_mutex_unlock(&arb->lock);
+}
+
+/*
+** Overwrites every grant word so sleepers, and anyone about to sleep,
+** leave acquire without forks.
+*/
+void	arbiter_stop(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->num_philos)
+	{
+		atomic_store(&table->arbiter.granted[i], ARBITER_STOP);
+		futex_wake(&table->arbiter.granted[i], 1);
+		i++;
+	}
+}
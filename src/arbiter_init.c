@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arbiter_init.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:22:38 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:22:38 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	arbiter_init(t_table *table)
+{
+	t_arbiter	*arb;
+	int			n;
+
+	arb = &table->arbiter;
+	n = table->num_philos;
+	pthread_mutex_init(&arb->lock, NULL);
+	arb->scratch = malloc(sizeof(t_heap_node) * n);
+	arb->busy = ft_calloc(n, 1);
+	arb->reserved = ft_calloc(n, 1);
+	arb->granted = ft_calloc(n, sizeof(atomic_int));
+	if (heap_init(&arb->pending, n) || !arb->scratch || !arb->busy
+		|| !arb->reserved || !arb->granted)
+		return (1);
+	return (0);
+}
+
+void	arbiter_free(t_table *table)
+{
+	t_arbiter	*arb;
+
+	arb = &table->arbiter;
+	pthread_mutex_destroy(&arb->lock);
+	heap_free(&arb->pending);
+	free(arb->scratch);
+	free(arb->busy);
+	free(arb->reserved);
+	free(arb->granted);
+	arb->scratch = NULL;
+	arb->busy = NULL;
+	arb->reserved = NULL;
+	arb->granted = NULL;
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:50:06 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:09:30 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static size_t	align_up(size_t v, size_t a)
+{
+	return ((v + a - 1) / a * a);
+}
+
+/*
+** One mapping holds the table, the forks, the per-meal hot state, the
+** hungry flags and the packed t_philo array, each starting on a cache
+** line. off[] gets the offsets of the last four.
+*/
+static size_t	arena_layout(int n, size_t *off)
+{
+	off[0] = align_up(sizeof(t_table), CACHE_LINE);
+	off[1] = off[0] + align_up(n * sizeof(t_fork), CACHE_LINE);
+	off[2] = off[1] + align_up(n * sizeof(t_philo_hot), CACHE_LINE);
+	off[3] = off[2] + align_up(n * sizeof(t_hunger), CACHE_LINE);
+	return (off[3] + align_up(n * sizeof(t_philo), CACHE_LINE));
+}
+
+/*
+** Anonymous mappings come zeroed. hugetlb needs pages reserved in
+** /proc/sys/vm/nr_hugepages, so without them it falls back to asking
+** for transparent huge pages, which only pays off from 2 MiB up.
+*/
+static void	*arena_map(size_t *len, t_huge_mode *huge)
+{
+	void	*mem;
+
+	if (*huge == HUGE_TLB)
+	{
+		mem = mmap(NULL, align_up(*len, HUGE_PAGE_SIZE), PROT_READ
+				| PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (mem != MAP_FAILED)
+		{
+			*len = align_up(*len, HUGE_PAGE_SIZE);
+			return (mem);
+		}
+		ft_dprintf(2, "philo: --hugepages=hugetlb unavailable, using thp\n");
+		*huge = HUGE_THP;
+	}
+	mem = mmap(NULL, *len, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED)
+		return (NULL);
+	if (*huge == HUGE_THP && *len >= HUGE_PAGE_SIZE)
+		madvise(mem, *len, MADV_HUGEPAGE);
+	return (mem);
+}
+
+/*
+** The single allocation behind a run: n is 0 for engines that keep no
+** per-philosopher forks or threads (des), which then get the table only.
+*/
+t_table	*arena_alloc(int n, t_huge_mode huge)
+{
+	t_table	*table;
+	size_t	off[4];
+	size_t	len;
+
+	len = arena_layout(n, off);
+	table = arena_map(&len, &huge);
+	if (!table)
+		return (NULL);
+	table->arena.len = len;
+	table->arena.huge = huge;
+	if (n <= 0)
+		return (table);
+	table->forks = (t_fork *)((char *)table + off[0]);
+	table->hot = (t_philo_hot *)((char *)table + off[1]);
+	table->hunger = (t_hunger *)((char *)table + off[2]);
+	table->philo = (t_philo *)((char *)table + off[3]);
+	return (table);
+}
+
+void	arena_free(t_table *table)
+{
+	if (table)
+		munmap(table, table->arena.len);
+}
@@ -6,40 +6,43 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:20:51 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 15:15:26 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:10:36 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
+/*
+** Flushed right away: ft_printf() keeps stdout buffered until exit, which
+** would put a mid-run error after every log line written since.
+*/
 void	return_error(char *error_msg)
 {
 	ft_printf("Error: %s\n", error_msg);
+	ft_printf_flush(1);
 }
 
 void	cleanup(t_table *table)
 {
-	int	i;
-
 	if (!table)
 		return ;
-	if (table->forks)
-	{
-		i = 0;
-		while (i < table->num_philos)
-		{
-			pthread_mutex_destroy(&table->forks[i]);
-			i++;
-		}
-		free(table->forks);
-	}
-	if (table->philo)
-		free(table->philo);
-	pthread_mutex_destroy(&table->print_mutex);
-	pthread_mutex_destroy(&table->data_mutex);
-	free(table);
+	destroy_mutexes(table);
+	logger_destroy(table);
+	monitors_free(table);
+	des_free(table);
+	pool_free(table);
+	stats_free(table);
+	flight_free(table);
+	spawn_free(table);
+	if (table->strategy && table->strategy->free)
+		table->strategy->free(table);
+	arena_free(table);
 }
 
+/*
+** Only the first forks_ready locks went through pthread_mutex_init():
+** init_table() may have stopped partway, or never run (des).
+*/
 void	destroy_mutexes(t_table *table)
 {
 	int	i;
@@ -47,13 +50,12 @@ void	destroy_mutexes(t_table *table)
 	if (!table || !table->forks)
 		return ;
 	i = 0;
-	while (i < table->num_philos)
+	while (i < table->forks_ready)
 	{
-		pthread_mutex_destroy(&table->forks[i]);
+		pthread_mutex_destroy(&table->forks[i].lock);
 		i++;
 	}
-	pthread_mutex_destroy(&table->print_mutex);
-	pthread_mutex_destroy(&table->data_mutex);
+	table->forks_ready = 0;
 }
 
 void	error_exit(char *error_msg)
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   death_probe.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:01:53 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:05:20 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Writer thread only: stamps the first flush that follows the "died" line.
+** That flush may only have submitted the write (--sink=uring), so an
+** empty flush first waits for it to complete; the other sinks have
+** nothing left to do by then.
+*/
+void	death_printed(t_table *table)
+{
+	if (!table->log.stopped || !table->death.detected
+		|| table->death.printed)
+		return ;
+	logger_flush(&table->log, 0);
+	table->death.printed = now_precise();
+}
+
+/*
+** With --death-log, appends "<detect_ns> <print_ns>" for the death that
+** ended the run, both measured from the true deadline, so that repeated
+** runs build up a latency sample (see bench/death_latency.sh).
+*/
+int	death_report(t_table *table)
+{
+	char	line[64];
+	int		len;
+	int		fd;
+
+	if (!table->opt.death_log || !table->death.detected)
+		return (0);
+	fd = open(table->opt.death_log, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (fd < 0)
+		return (1);
+	len = ft_snprintf(line, sizeof(line), "%ld %ld\n",
+			(long)(table->death.detected - table->death.deadline),
+			(long)(table->death.printed - table->death.deadline));
+	if (write(fd, line, len) != len)
+		len = -1;
+	close(fd);
+	return (len < 0);
+}
+
+/*
+** With --join-log, appends "<philos> <join_ns>": the time from the run
+** ending to the last philosopher thread being joined (see
+** bench/join_latency.sh).
+*/
+int	join_report(t_table *table, t_nsec joined)
+{
+	char	line[64];
+	int		len;
+	int		fd;
+
+	if (!table->opt.join_log || !table->stop_at)
+		return (0);
+	fd = open(table->opt.join_log, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (fd < 0)
+		return (1);
+	len = ft_snprintf(line, sizeof(line), "%d %ld\n", table->num_philos,
+			(long)(joined - table->stop_at));
+	if (write(fd, line, len) != len)
+		len = -1;
+	close(fd);
+	return (len < 0);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:28:24 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:45:25 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+void	des_emit(t_table *table, t_des *des, int i, t_state state)
+{
+	t_event	ev;
+
+	ev.ts = des->vt * NS_PER_US;
+	ev.id = i + 1;
+	ev.seq = 0;
+	ev.state = state;
+	format_event(table, &ev);
+}
+
+/*
+** Pops the earliest of the next wakeup and the next death deadline, deaths
+** first on a tie. Returns 0 once somebody died.
+*/
+static int	des_step(t_table *table, t_des *des)
+{
+	int	i;
+
+	if (!des->events.size || des->deaths.nodes[0].key >> DES_ID_BITS
+		<= des->events.nodes[0].key >> DES_ID_BITS)
+	{
+		des->vt = des->deaths.nodes[0].key >> DES_ID_BITS;
+		des_emit(table, des, des->deaths.nodes[0].item, ST_DIED);
+		return (0);
+	}
+	des->vt = des->events.nodes[0].key >> DES_ID_BITS;
+	i = heap_pop(&des->events);
+	if (des->phase[i] == PH_EAT_DONE)
+		des_release(table, des, i);
+	else
+		des_advance(table, des, i);
+	return (1);
+}
+
+/*
+** Runs the same think / take_forks / eat / sleep cycle as the threads in
+** virtual time, with no threads and no sleeping, until someone dies or
+** everyone ate.
+*/
+int	des_run(t_table *table)
+{
+	t_des	*des;
+	int		i;
+
+	des = table->des;
+	table->start = 0;
+	table->simulation = 1;
+	trace_begin(table);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		heap_push(&des->deaths, i, ((table->die_ns / NS_PER_US)
+				<< DES_ID_BITS) | i);
+		des_schedule(table, des, i, start_offset(table, i + 1) / NS_PER_US);
+		i++;
+	}
+	while (table->simulation && des_step(table, des))
+		;
+	logger_flush(&table->log, 0);
+	return (0);
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_init.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:29:05 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static int	des_alloc(t_des *des, int n)
+{
+	des->last_meal = ft_calloc(n, sizeof(long));
+	des->meals = ft_calloc(n, sizeof(int));
+	des->phase = ft_calloc(n, sizeof(char));
+	des->owner = malloc(sizeof(int) * n);
+	des->waiter = malloc(sizeof(int) * n);
+	if (!des->last_meal || !des->meals || !des->phase || !des->owner
+		|| !des->waiter || heap_init(&des->events, n)
+		|| heap_init(&des->deaths, n))
+		return (1);
+	ft_memset(des->owner, -1, sizeof(int) * n);
+	ft_memset(des->waiter, -1, sizeof(int) * n);
+	return (0);
+}
+
+/*
+** The event engine does not need forks, threads, rings or monitors, so it
+** skips init_table() and only keeps the writer's output buffer.
+*/
+int	des_init(t_table *table)
+{
+	if (table->num_philos >= (1 << DES_ID_BITS))
+	{
+		ft_printf("Error: --engine=des supports up to %d philosophers\n",
+			(1 << DES_ID_BITS) - 1);
+		return (1);
+	}
+	table->des = ft_calloc(1, sizeof(t_des));
+	table->log.buf = malloc(LOG_BUF_SIZE);
+	if (!table->des || !table->log.buf || sink_open(table))
+		return (1);
+	table->des->rng = (uint64_t)table->opt.seed;
+	return (des_alloc(table->des, table->num_philos));
+}
+
+void	des_free(t_table *table)
+{
+	t_des	*des;
+
+	des = table->des;
+	if (!des)
+		return ;
+	free(des->last_meal);
+	free(des->meals);
+	free(des->phase);
+	free(des->owner);
+	free(des->waiter);
+	heap_free(&des->events);
+	heap_free(&des->deaths);
+	free(des);
+	table->des = NULL;
+}
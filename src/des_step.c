@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_step.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:28:24 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:30:22 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** With a seed, every wakeup is pushed back by up to DES_JITTER_US to model
+** scheduler noise; without one the run is fully deterministic.
+*/
+void	des_schedule(t_table *table, t_des *des, int i, long delay)
+{
+	if (table->opt.seed)
+	{
+		des->rng ^= des->rng << 13;
+		des->rng ^= des->rng >> 7;
+		des->rng ^= des->rng << 17;
+		delay += des->rng % DES_JITTER_US;
+	}
+	heap_push(&des->events, i, ((des->vt + delay) << DES_ID_BITS) | i);
+}
+
+static int	des_take(t_des *des, int i, int fork)
+{
+	if (des->owner[fork] == i)
+		return (1);
+	if (des->owner[fork] == -1)
+	{
+		des->owner[fork] = i;
+		return (1);
+	}
+	des->waiter[fork] = i;
+	return (0);
+}
+
+/*
+** Forks go straight to the neighbour waiting on them, who resumes at the
+** current virtual time.
+*/
+void	des_release(t_table *table, t_des *des, int i)
+{
+	int	fork;
+	int	k;
+
+	k = 0;
+	while (k < 2)
+	{
+		fork = (i + k) % table->num_philos;
+		des->owner[fork] = des->waiter[fork];
+		if (des->waiter[fork] != -1)
+		{
+			des_schedule(table, des, des->waiter[fork], 0);
+			des->waiter[fork] = -1;
+		}
+		k++;
+	}
+	des_emit(table, des, i, ST_SLEEP);
+	des->phase[i] = PH_THINK;
+	des_schedule(table, des, i, table->time_to_sleep * 1000);
+}
+
+static void	des_eat(t_table *table, t_des *des, int i)
+{
+	des_emit(table, des, i, ST_EAT);
+	des->last_meal[i] = des->vt;
+	des->meals[i]++;
+	heap_update(&des->deaths, i, ((des->vt + table->die_ns / NS_PER_US)
+			<< DES_ID_BITS) | i);
+	des->phase[i] = PH_EAT_DONE;
+	des_schedule(table, des, i, table->time_to_eat * 1000);
+	if (des->meals[i] != table->meals_required)
+		return ;
+	des->full++;
+	if (des->full == table->num_philos)
+	{
+		des_emit(table, des, i, ST_ALL_ATE);
+		table->simulation = 0;
+	}
+}
+
+void	des_advance(t_table *table, t_des *des, int i)
+{
+	int	first;
+	int	second;
+
+	first = (i + i % 2) % table->num_philos;
+	second = (i + 1 - i % 2) % table->num_philos;
+	if (des->phase[i] == PH_THINK)
+	{
+		des_emit(table, des, i, ST_THINK);
+		des->phase[i] = PH_WANT_FIRST;
+	}
+	if (des->phase[i] == PH_WANT_FIRST)
+	{
+		if (!des_take(des, i, first))
+			return ;
+		des_emit(table, des, i, ST_FORK);
+		des->phase[i] = PH_WANT_SECOND;
+	}
+	if (table->num_philos == 1 || !des_take(des, i, second))
+		return ;
+	des_emit(table, des, i, ST_FORK);
+	des_eat(table, des, i);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flight.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:08:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:08:10 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Always on: 320 bytes per philosopher, one of them per cache line set,
+** so recording never touches a line another thread writes.
+*/
+int	flight_init(t_table *table)
+{
+	table->flight = cache_alloc(table->num_philos, sizeof(t_flight));
+	return (table->flight == NULL);
+}
+
+void	flight_free(t_table *table)
+{
+	free(table->flight);
+	table->flight = NULL;
+}
+
+/*
+** Seqlock write: odd seq, the fields, even seq. The release fence keeps
+** the fields from becoming visible before the odd value.
+*/
+void	flight_record(t_flight *flight, t_nsec ts, t_state state)
+{
+	t_flight_slot	*slot;
+	unsigned int	seq;
+
+	slot = &flight->slots[flight->head % FLIGHT_EVENTS];
+	flight->head++;
+	seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+	atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&slot->ts, ts, memory_order_relaxed);
+	atomic_store_explicit(&slot->state, state, memory_order_relaxed);
+	atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+}
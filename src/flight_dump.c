@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flight_dump.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:08:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:04:50 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Seqlock read of one slot, retried while its owner is rewriting it.
+** Returns 0 for a slot that was never written.
+*/
+static int	slot_read(t_flight_slot *slot, t_event *ev)
+{
+	unsigned int	s1;
+	unsigned int	s2;
+
+	while (1)
+	{
+		s1 = atomic_load_explicit(&slot->seq, memory_order_acquire);
+		if (s1 == 0)
+			return (0);
+		ev->ts = atomic_load_explicit(&slot->ts, memory_order_relaxed);
+		ev->state = atomic_load_explicit(&slot->state, memory_order_relaxed);
+		atomic_thread_fence(memory_order_acquire);
+		s2 = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+		if (s1 == s2 && !(s1 & 1))
+			return (1);
+		cpu_relax();
+	}
+}
+
+static int	event_ts_cmp(const void *a, const void *b)
+{
+	const t_event	*x;
+	const t_event	*y;
+
+	x = (const t_event *)a;
+	y = (const t_event *)b;
+	if (x->ts != y->ts)
+		return ((x->ts > y->ts) - (x->ts < y->ts));
+	return (x->id - y->id);
+}
+
+/*
+** Appends the recorder of philosopher id (1-based, wrapped around the
+** table) to ev unless it is already there.
+*/
+static int	collect(t_table *table, int id, t_event *ev, int n)
+{
+	int	i;
+
+	id = (id - 1 + table->num_philos) % table->num_philos + 1;
+	i = 0;
+	while (i < n && ev[i].id != id)
+		i++;
+	if (i < n)
+		return (n);
+	i = 0;
+	while (i < FLIGHT_EVENTS)
+	{
+		ev[n].id = id;
+		ev[n].seq = 0;
+		n += slot_read(&table->flight[id - 1].slots[i], &ev[n]);
+		i++;
+	}
+	return (n);
+}
+
+/*
+** Prints the merged recent history of philosopher_id and its neighbours
+** on stderr, timestamps in milliseconds since the start. With
+** --clock-tick the first events can read a tick older than the epoch;
+** they are shown at 0 like in the log.
+*/
+void	flight_dump(t_table *table, int philo_id, const char *why)
+{
+	t_event	ev[3 * FLIGHT_EVENTS];
+	t_nsec	t;
+	int		n;
+	int		i;
+
+	n = collect(table, philo_id, ev, 0);
+	n = collect(table, philo_id - 1, ev, n);
+	n = collect(table, philo_id + 1, ev, n);
+	qsort(ev, n, sizeof(t_event), event_ts_cmp);
+	ft_dprintf(2, "philo: flight recorder, philosopher %d (%s)"
+		" and neighbours\n", philo_id, why);
+	i = 0;
+	while (i < n)
+	{
+		t = ev[i].ts - table->start;
+		if (t < 0)
+			t = 0;
+		ft_dprintf(2, "%8ld.%06ld %d %s\n", (long)(t / NS_PER_MS),
+			(long)(t % NS_PER_MS), ev[i].id, state_name(ev[i].state));
+		i++;
+	}
+}
+
+/*
+** SIGUSR1: nobody died yet, so show the philosopher closest to death.
+*/
+void	flight_dump_likely(t_table *table)
+{
+	t_nsec	oldest;
+	t_nsec	meal;
+	int		worst;
+	int		i;
+
+	worst = 0;
+	oldest = INT64_MAX;
+	i = 0;
+	while (i < table->num_philos)
+	{
+		meal = atomic_load_explicit(&table->hot[i].last_meal,
+				memory_order_relaxed);
+		if (meal < oldest)
+		{
+			oldest = meal;
+			worst = i;
+		}
+		i++;
+	}
+	flight_dump(table, worst + 1, "longest since a meal");
+}
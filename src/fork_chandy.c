@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_chandy.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:31 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Waits until philosopher me owns fork f, or returns 0 once the run has
+** ended. A fork changes hands only when it is dirty and its owner is not
+** eating, and it arrives clean, so the neighbour that just got it keeps
+** it until it has eaten.
+*/
+static int	cm_take(t_table *table, int me, int f)
+{
+	t_cm_fork	*fork;
+	int			running;
+
+	fork = &table->cm[f];
+	pthread_mutex_lock(&table->forks[f].lock);
+	running = atomic_load(&table->simulation);
+	while (running && fork->owner != me
+		&& (!fork->dirty || table->hot[fork->owner].eating))
+	{
+		pthread_cond_wait(&fork->cond, &table->forks[f].lock);
+		running = atomic_load(&table->simulation);
+	}
+	if (running && fork->owner != me)
+	{
+		fork->owner = me;
+		fork->dirty = 0;
+	}
+	pthread_mutex_unlock(&table->forks[f].lock);
+	return (running);
+}
+
+/*
+** A fork we already owned dirty may have gone to a neighbour while we
+** waited for the other one, so ownership of both is checked again under
+** both locks before eating.
+*/
+static int	cm_claim(t_table *table, int me, int a, int b)
+{
+	int	ok;
+
+	pthread_mutex_lock(&table->forks[a].lock);
+	pthread_mutex_lock(&table->forks[b].lock);
+	ok = (table->cm[a].owner == me && table->cm[b].owner == me);
+	table->hot[me].eating = ok;
+	pthread_mutex_unlock(&table->forks[b].lock);
+	pthread_mutex_unlock(&table->forks[a].lock);
+	return (ok);
+}
+
+int	chandy_acquire(t_philo *philo, t_table *table)
+{
+	int	me;
+	int	a;
+	int	b;
+
+	me = philo->id - 1;
+	a = me;
+	b = philo->id % table->num_philos;
+	if (b < a)
+	{
+		a = b;
+		b = me;
+	}
+	while (cm_take(table, me, a) && cm_take(table, me, b))
+	{
+		if (cm_claim(table, me, a, b))
+		{
+			print_status(table, philo->id, ST_FORK);
+			print_status(table, philo->id, ST_FORK);
+			return (1);
+		}
+	}
+	return (0);
+}
+
+/*
+** Eating dirties both forks: any neighbour waiting for one may take it.
+*/
+void	chandy_release(t_philo *philo, t_table *table)
+{
+	int	a;
+	int	b;
+
+	a = philo->id - 1;
+	b = philo->id % table->num_philos;
+	if (b < a)
+	{
+		a = b;
+		b = philo->id - 1;
+	}
+	pthread_mutex_lock(&table->forks[a].lock);
+	pthread_mutex_lock(&table->forks[b].lock);
+	philo->hot->eating = 0;
+	table->cm[a].dirty = 1;
+	table->cm[b].dirty = 1;
+	pthread_cond_broadcast(&table->cm[a].cond);
+	pthread_cond_broadcast(&table->cm[b].cond);
+	pthread_mutex_unlock(&table->forks[b].lock);
+	pthread_mutex_unlock(&table->forks[a].lock);
+}
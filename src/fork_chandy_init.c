@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_chandy_init.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:31 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Every fork starts dirty with the lower-indexed of its two philosophers,
+** which orders the precedence graph so that no cycle of waits can form.
+*/
+int	chandy_init(t_table *table)
+{
+	int	i;
+
+	table->cm = cache_alloc(table->num_philos, sizeof(t_cm_fork));
+	if (!table->cm)
+		return (1);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		pthread_cond_init(&table->cm[i].cond, NULL);
+		table->cm[i].owner = i - (i > 0);
+		table->cm[i].dirty = 1;
+		i++;
+	}
+	return (0);
+}
+
+void	chandy_free(t_table *table)
+{
+	int	i;
+
+	if (!table->cm)
+		return ;
+	i = 0;
+	while (i < table->num_philos)
+	{
+		pthread_cond_destroy(&table->cm[i].cond);
+		i++;
+	}
+	free(table->cm);
+	table->cm = NULL;
+}
+
+/*
+** cm_take() reads simulation under the fork lock before waiting, so a
+** broadcast under the same lock cannot be missed.
+*/
+void	chandy_stop(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->num_philos)
+	{
+		pthread_mutex_lock(&table->forks[i].lock);
+		pthread_cond_broadcast(&table->cm[i].cond);
+		pthread_mutex_unlock(&table->forks[i].lock);
+		i++;
+	}
+}
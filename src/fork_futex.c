@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_futex.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:45:42 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Takes every fork of mask at once, with one CAS on the block's word.
+** Fails while any of them is held, and for good after futex_stop().
+*/
+static int	block_try(atomic_int *word, int mask)
+{
+	int	v;
+
+	v = atomic_load_explicit(word, memory_order_relaxed);
+	while (!(v & (mask | FORK_STOP)))
+	{
+		if (atomic_compare_exchange_weak_explicit(word, &v, v | mask,
+				memory_order_acquire, memory_order_relaxed))
+			return (1);
+	}
+	return (0);
+}
+
+/*
+** Sleeps until a held fork of mask is put down. Their waiter bits tell
+** the release to wake, and the futex bitset is those forks, so a release
+** of any other fork in the block leaves us asleep. A fork is shared by
+** two philosophers only: its release wakes exactly the one waiting.
+*/
+static void	block_park(atomic_int *word, int mask)
+{
+	int	v;
+	int	busy;
+	int	want;
+
+	v = atomic_load(word);
+	busy = v & mask;
+	if (!busy || (v & FORK_STOP))
+		return ;
+	want = v | busy << FORK_WAITERS;
+	if (want != v && !atomic_compare_exchange_strong(word, &v, want))
+		return ;
+	futex_wait_mask(word, want, busy);
+}
+
+/*
+** Leaves acquire. The hungry flag is cleared either way, so neighbours
+** deferring to us wake up; tries < 0 means the run ended with no fork
+** taken.
+*/
+static int	take_done(t_philo *philo, t_table *table, int tries)
+{
+	fork_fed(philo->hunger);
+	if (tries < 0)
+		return (0);
+	philo->hunger->spin += (tries - philo->hunger->spin) / 8;
+	print_status(table, philo->id, ST_FORK);
+	print_status(table, philo->id, ST_FORK);
+	return (1);
+}
+
+/*
+** Spins, then parks until the forks of seat word k are free. On the first
+** word it also parks on a hungrier neighbour it has to let eat first (see
+** fork_rival()), never on the second: we already hold a fork that
+** neighbour may need. Returns the attempts made, -1 once the run ended.
+*/
+static int	block_take(t_philo *philo, t_table *table, int k)
+{
+	t_seat		*seat;
+	t_hunger	*rival;
+	int			tries;
+
+	seat = &philo->hunger->seat;
+	tries = 0;
+	rival = NULL;
+	if (k == 0)
+		rival = fork_rival(philo, table);
+	while (rival || !block_try(seat->word[k], seat->mask[k]))
+	{
+		if (!atomic_load_explicit(&table->simulation, memory_order_acquire))
+			return (-1);
+		tries += (tries < spin_budget(philo->hunger->spin));
+		if (tries < spin_budget(philo->hunger->spin))
+			cpu_relax();
+		else if (rival)
+			fork_wait_rival(rival);
+		else
+			block_park(seat->word[k], seat->mask[k]);
+		if (k == 0)
+			rival = fork_rival(philo, table);
+	}
+	return (tries);
+}
+
+/*
+** Both forks in one CAS when they share a block word. A seat whose forks
+** straddle two words holds the lower fork while it waits for the higher:
+** every such seat takes its words in fork order and nobody else waits
+** holding anything, so no cycle can form. futex_on_think() has already
+** published that we are hungry.
+*/
+int	futex_take_forks(t_philo *philo, t_table *table)
+{
+	t_seat	*seat;
+	int		tries;
+	int		more;
+
+	seat = &philo->hunger->seat;
+	tries = block_take(philo, table, 0);
+	if (tries >= 0 && seat->words == 2)
+	{
+		more = block_take(philo, table, 1);
+		if (more < 0)
+		{
+			fork_block_release(seat->word[0], seat->mask[0]);
+			tries = -1;
+		}
+		else
+			tries += more;
+	}
+	return (take_done(philo, table, tries));
+}
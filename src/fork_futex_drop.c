@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_futex_drop.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:26:19 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Clears the forks of mask and their waiter bits in one step, then wakes
+** only the waiters whose bitset holds one of those forks.
+*/
+void	fork_block_release(atomic_int *word, int mask)
+{
+	int	old;
+
+	old = atomic_fetch_and_explicit(word, ~(mask | mask << FORK_WAITERS),
+			memory_order_release);
+	if (old & mask << FORK_WAITERS)
+		futex_wake_mask(word, (old >> FORK_WAITERS) & mask);
+}
+
+void	futex_drop_forks(t_philo *philo, t_table *table)
+{
+	t_seat	*seat;
+
+	(void)table;
+	seat = &philo->hunger->seat;
+	fork_block_release(seat->word[0], seat->mask[0]);
+	if (seat->words == 2)
+		fork_block_release(seat->word[1], seat->mask[1]);
+}
+
+/*
+** Changes every word a philosopher may sleep on, so its futex_wait()
+** fails even if it checked the run just before it ended: FORK_STOP on
+** each block, and hungry back to 0 so nobody defers to a rival any more.
+*/
+void	futex_stop(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < (table->num_philos + FORK_BLOCK - 1) / FORK_BLOCK)
+	{
+		atomic_fetch_or(&table->blocks[i].word, FORK_STOP);
+		futex_wake(&table->blocks[i].word, INT_MAX);
+		i++;
+	}
+	i = 0;
+	while (i < table->num_philos)
+	{
+		atomic_store(&table->hunger[i].hungry, 0);
+		futex_wake(&table->hunger[i].hungry, INT_MAX);
+		i++;
+	}
+}
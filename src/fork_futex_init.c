@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_futex_init.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:43:56 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Philosopher i eats with forks i and i + 1, fork 0 for the last one.
+** Both land in one word unless they straddle a FORK_BLOCK boundary or,
+** past FORK_BLOCK philosophers, the wrap-around.
+*/
+static void	seat_init(t_table *table, int i, t_seat *seat)
+{
+	int	lo;
+	int	hi;
+
+	lo = i;
+	hi = (i + 1) % table->num_philos;
+	if (hi < lo)
+	{
+		hi = lo;
+		lo = 0;
+	}
+	seat->word[0] = &table->blocks[lo / FORK_BLOCK].word;
+	seat->word[1] = &table->blocks[hi / FORK_BLOCK].word;
+	seat->mask[0] = 1 << lo % FORK_BLOCK;
+	seat->mask[1] = 1 << hi % FORK_BLOCK;
+	seat->words = 2;
+	if (seat->word[0] == seat->word[1])
+	{
+		seat->mask[0] |= seat->mask[1];
+		seat->words = 1;
+	}
+}
+
+int	futex_init(t_table *table)
+{
+	int	i;
+
+	table->blocks = cache_alloc((table->num_philos + FORK_BLOCK - 1)
+			/ FORK_BLOCK, sizeof(t_fork_block));
+	if (!table->blocks)
+		return (1);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		seat_init(table, i, &table->hunger[i].seat);
+		i++;
+	}
+	return (0);
+}
+
+void	futex_free(t_table *table)
+{
+	free(table->blocks);
+	table->blocks = NULL;
+}
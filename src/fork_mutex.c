@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_mutex.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:08 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+void	mutex_lock_pair(t_philo *philo, t_table *table,
+		pthread_mutex_t *first, pthread_mutex_t *second)
+{
+	pthread_mutex_lock(first);
+	print_status(table, philo->id, ST_FORK);
+	pthread_mutex_lock(second);
+	print_status(table, philo->id, ST_FORK);
+}
+
+/*
+** Even ids reach right first and odd ids left first, so two neighbours
+** never each hold the fork the other one is waiting for.
+*/
+int	odd_even_acquire(t_philo *philo, t_table *table)
+{
+	if (philo->id % 2 == 0)
+		mutex_lock_pair(philo, table, philo->fork_right, philo->fork_left);
+	else
+		mutex_lock_pair(philo, table, philo->fork_left, philo->fork_right);
+	return (1);
+}
+
+/*
+** Resource hierarchy: forks are taken in index order, which only the last
+** philosopher (left fork N - 1, right fork 0) has to reverse.
+*/
+int	hierarchy_acquire(t_philo *philo, t_table *table)
+{
+	if (philo->id == table->num_philos)
+		mutex_lock_pair(philo, table, philo->fork_right, philo->fork_left);
+	else
+		mutex_lock_pair(philo, table, philo->fork_left, philo->fork_right);
+	return (1);
+}
+
+void	mutex_release(t_philo *philo, t_table *table)
+{
+	(void)table;
+	pthread_mutex_unlock(philo->fork_left);
+	pthread_mutex_unlock(philo->fork_right);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_rival.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:46:52 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Taking both forks in one CAS never deadlocks but can starve: the two
+** neighbours of a philosopher may keep taking turns on its forks. So a
+** hungry philosopher leaves the forks to a hungry neighbour that has
+** waited longer for its meal (older last_meal, lower id on a tie). The
+** order is total, so the hungriest philosopher never defers to anyone.
+*/
+static int	outranks(t_table *table, int other, t_philo *me)
+{
+	t_nsec	a;
+	t_nsec	b;
+
+	if (!atomic_load_explicit(&table->hunger[other].hungry,
+			memory_order_acquire))
+		return (0);
+	a = atomic_load_explicit(&table->hot[other].last_meal,
+			memory_order_relaxed);
+	b = atomic_load_explicit(&me->hot->last_meal, memory_order_relaxed);
+	return (a < b || (a == b && other + 1 < me->id));
+}
+
+t_hunger	*fork_rival(t_philo *philo, t_table *table)
+{
+	int	left;
+	int	right;
+
+	left = (philo->id - 2 + table->num_philos) % table->num_philos;
+	right = philo->id % table->num_philos;
+	if (outranks(table, left, philo))
+		return (&table->hunger[left]);
+	if (outranks(table, right, philo))
+		return (&table->hunger[right]);
+	return (NULL);
+}
+
+/*
+** hungry is 0, 1 while trying to eat, 2 once a neighbour sleeps on it;
+** fork_fed() wakes those sleepers as soon as it has its forks.
+*/
+void	fork_wait_rival(t_hunger *rival)
+{
+	int	v;
+
+	v = 1;
+	if (!atomic_compare_exchange_strong(&rival->hungry, &v, 2) && v != 2)
+		return ;
+	futex_wait(&rival->hungry, 2);
+}
+
+/*
+** The hungry flag goes up as soon as the philosopher starts thinking, so
+** its neighbours already defer to it while it walks to the table.
+*/
+void	futex_on_think(t_philo *philo, t_table *table)
+{
+	(void)table;
+	atomic_store(&philo->hunger->hungry, 1);
+}
+
+void	fork_fed(t_hunger *me)
+{
+	if (atomic_exchange(&me->hungry, 0) == 2)
+		futex_wake(&me->hungry, 2);
+}
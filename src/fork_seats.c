@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_seats.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:08 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** At most N - 1 philosophers reach for forks at once, so at least one of
+** them finds both free and the plain left-then-right order cannot
+** deadlock.
+*/
+int	seats_init(t_table *table)
+{
+	return (sem_init(&table->seats, 0, table->num_philos - 1) != 0);
+}
+
+void	seats_free(t_table *table)
+{
+	sem_destroy(&table->seats);
+}
+
+int	seats_acquire(t_philo *philo, t_table *table)
+{
+	while (sem_wait(&table->seats) != 0)
+		;
+	if (!atomic_load_explicit(&table->simulation, memory_order_acquire))
+		return (0);
+	mutex_lock_pair(philo, table, philo->fork_left, philo->fork_right);
+	return (1);
+}
+
+void	seats_release(t_philo *philo, t_table *table)
+{
+	mutex_release(philo, table);
+	sem_post(&table->seats);
+}
+
+/*
+** One extra seat per philosopher: whoever is still queued gets through
+** sem_wait() and sees the run is over.
+*/
+void	seats_stop(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->num_philos)
+	{
+		sem_post(&table->seats);
+		i++;
+	}
+}
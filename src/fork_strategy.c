@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_strategy.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:08 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Every fork protocol, indexed by t_fork_mode. A lone philosopher and the
+** tasks engine never get here: take_forks() handles both itself. The
+** mutex strategies need no stop hook: every holder is woken out of its
+** meal or nap and unlocks, so blocked lockers get through at once.
+*/
+const t_strategy	*strategy_of(t_fork_mode mode)
+{
+	static const t_strategy	list[FORKS_COUNT] = {
+	[FORKS_ODD_EVEN] = {"odd-even", NULL, NULL, NULL,
+		odd_even_acquire, mutex_release, NULL},
+	[FORKS_HIERARCHY] = {"hierarchy", NULL, NULL, NULL,
+		hierarchy_acquire, mutex_release, NULL},
+	[FORKS_SEATS] = {"seats", seats_init, seats_free, NULL,
+		seats_acquire, seats_release, seats_stop},
+	[FORKS_CHANDY_MISRA] = {"chandy-misra", chandy_init, chandy_free, NULL,
+		chandy_acquire, chandy_release, chandy_stop},
+	[FORKS_TICKET] = {"ticket", NULL, NULL, NULL,
+		ticket_acquire, ticket_release, ticket_stop},
+	[FORKS_ARBITER] = {"arbiter", arbiter_init, arbiter_free, NULL,
+		arbiter_take, arbiter_drop, arbiter_stop},
+	[FORKS_FUTEX] = {"futex", futex_init, futex_free, futex_on_think,
+		futex_take_forks, futex_drop_forks, futex_stop}
+	};
+
+	return (&list[mode]);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_ticket.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:16 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** A ticket lock per fork: waiters are served in the order they arrived,
+** so a neighbour that keeps coming back can never overtake. Spins for a
+** while, then sleeps on serving until the holder advances it. Returns 0
+** without the fork once the run has ended.
+*/
+static int	ticket_lock(t_fork *fork, t_table *table)
+{
+	int	ticket;
+	int	now;
+	int	tries;
+
+	ticket = atomic_fetch_add(&fork->next, 1);
+	tries = 0;
+	now = atomic_load_explicit(&fork->serving, memory_order_acquire);
+	while (now != ticket)
+	{
+		if (!atomic_load_explicit(&table->simulation, memory_order_acquire))
+			return (0);
+		tries += (tries < FORK_SPIN_MAX);
+		if (tries < FORK_SPIN_MAX)
+			cpu_relax();
+		else
+			futex_wait(&fork->serving, now);
+		now = atomic_load_explicit(&fork->serving, memory_order_acquire);
+	}
+	return (1);
+}
+
+/*
+** Only enters the kernel when somebody took a ticket after ours.
+*/
+static void	ticket_unlock(t_fork *fork)
+{
+	int	serving;
+
+	serving = atomic_fetch_add_explicit(&fork->serving, 1,
+			memory_order_release) + 1;
+	if (atomic_load(&fork->next) != serving)
+		futex_wake(&fork->serving, INT_MAX);
+}
+
+/*
+** Forks are taken in index order as in the hierarchy strategy, which is
+** what keeps two FIFO locks from deadlocking.
+*/
+int	ticket_acquire(t_philo *philo, t_table *table)
+{
+	t_fork	*first;
+	t_fork	*second;
+
+	first = &table->forks[philo->id - 1];
+	second = &table->forks[philo->id % table->num_philos];
+	if (philo->id == table->num_philos)
+	{
+		first = &table->forks[0];
+		second = &table->forks[philo->id - 1];
+	}
+	if (!ticket_lock(first, table))
+		return (0);
+	print_status(table, philo->id, ST_FORK);
+	if (!ticket_lock(second, table))
+	{
+		ticket_unlock(first);
+		return (0);
+	}
+	print_status(table, philo->id, ST_FORK);
+	return (1);
+}
+
+void	ticket_release(t_philo *philo, t_table *table)
+{
+	ticket_unlock(&table->forks[philo->id - 1]);
+	ticket_unlock(&table->forks[philo->id % table->num_philos]);
+}
+
+/*
+** TICKET_STOP makes serving match no ticket, so a sleeper that checked
+** the run just before it ended still fails its futex_wait() and returns.
+*/
+void	ticket_stop(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->num_philos)
+	{
+		atomic_fetch_or(&table->forks[i].serving, TICKET_STOP);
+		futex_wake(&table->forks[i].serving, INT_MAX);
+		i++;
+	}
+}
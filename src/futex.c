@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   futex.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:18:20 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:43:56 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+long	futex_wait(atomic_int *addr, int expected)
+{
+	return (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected,
+			NULL, NULL, 0));
+}
+
+/*
+** Sleeps while *addr == expected, at most until the absolute
+** CLOCK_MONOTONIC deadline. FUTEX_WAIT_BITSET is the only futex wait
+** that takes an absolute timeout.
+*/
+long	futex_wait_until(atomic_int *addr, int expected, t_nsec deadline)
+{
+	struct timespec	ts;
+
+	ts.tv_sec = deadline / NS_PER_SEC;
+	ts.tv_nsec = deadline % NS_PER_SEC;
+	return (syscall(SYS_futex, addr, FUTEX_WAIT_BITSET_PRIVATE, expected,
+			&ts, NULL, FUTEX_BITSET_MATCH_ANY));
+}
+
+long	futex_wake(atomic_int *addr, int count)
+{
+	return (syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count,
+			NULL, NULL, 0));
+}
+
+/*
+** The bitset variants: a waiter sleeps on the bits of mask and is only
+** woken by a futex_wake_mask() whose mask shares one of them; a plain
+** futex_wake() still wakes every waiter.
+*/
+long	futex_wait_mask(atomic_int *addr, int expected, int mask)
+{
+	return (syscall(SYS_futex, addr, FUTEX_WAIT_BITSET_PRIVATE, expected,
+			NULL, NULL, mask));
+}
+
+long	futex_wake_mask(atomic_int *addr, int mask)
+{
+	return (syscall(SYS_futex, addr, FUTEX_WAKE_BITSET_PRIVATE, INT_MAX,
+			NULL, NULL, mask));
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:18:20 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:18:20 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	heap_init(t_heap *heap, int cap)
+{
+	int	i;
+
+	heap->nodes = malloc(sizeof(t_heap_node) * cap);
+	heap->pos = malloc(sizeof(int) * cap);
+	heap->size = 0;
+	heap->cap = cap;
+	if (!heap->nodes || !heap->pos)
+	{
+		heap_free(heap);
+		return (1);
+	}
+	i = 0;
+	while (i < cap)
+	{
+		heap->pos[i] = -1;
+		i++;
+	}
+	return (0);
+}
+
+void	heap_free(t_heap *heap)
+{
+	free(heap->nodes);
+	free(heap->pos);
+	heap->nodes = NULL;
+	heap->pos = NULL;
+	heap->size = 0;
+}
+
+void	heap_push(t_heap *heap, int item, t_nsec key)
+{
+	if (heap->pos[item] != -1)
+	{
+		heap_update(heap, item, key);
+		return ;
+	}
+	heap->nodes[heap->size].key = key;
+	heap->nodes[heap->size].item = item;
+	heap->pos[item] = heap->size;
+	heap->size++;
+	heap_sift_up(heap, heap->size - 1);
+}
+
+int	heap_pop(t_heap *heap)
+{
+	int	item;
+
+	item = heap->nodes[0].item;
+	heap->pos[item] = -1;
+	heap->size--;
+	if (heap->size > 0)
+	{
+		heap->nodes[0] = heap->nodes[heap->size];
+		heap->pos[heap->nodes[0].item] = 0;
+		heap_sift_down(heap, 0);
+	}
+	return (item);
+}
+
+void	heap_update(t_heap *heap, int item, t_nsec key)
+{
+	int		i;
+	t_nsec	old;
+
+	i = heap->pos[item];
+	old = heap->nodes[i].key;
+	heap->nodes[i].key = key;
+	if (key < old)
+		heap_sift_up(heap, i);
+	else
+		heap_sift_down(heap, i);
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap_sift.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:18:20 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:18:20 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static void	heap_swap(t_heap *heap, int a, int b)
+{
+	t_heap_node	tmp;
+
+	tmp = heap->nodes[a];
+	heap->nodes[a] = heap->nodes[b];
+	heap->nodes[b] = tmp;
+	heap->pos[heap->nodes[a].item] = a;
+	heap->pos[heap->nodes[b].item] = b;
+}
+
+void	heap_sift_up(t_heap *heap, int i)
+{
+	int	parent;
+
+	while (i > 0)
+	{
+		parent = (i - 1) / 2;
+		if (heap->nodes[parent].key <= heap->nodes[i].key)
+			return ;
+		heap_swap(heap, parent, i);
+		i = parent;
+	}
+}
+
+void	heap_sift_down(t_heap *heap, int i)
+{
+	int	child;
+
+	while (2 * i + 1 < heap->size)
+	{
+		child = 2 * i + 1;
+		if (child + 1 < heap->size
+			&& heap->nodes[child + 1].key < heap->nodes[child].key)
+			child++;
+		if (heap->nodes[i].key <= heap->nodes[child].key)
+			return ;
+		heap_swap(heap, i, child);
+		i = child;
+	}
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_line.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:13:36 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:15:33 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static const t_status_str	*status_str(t_state state)
+{
+	static const t_status_str	names[] = {{"has taken a fork", 16},
+	{"is eating", 9}, {"is sleeping", 11}, {"is thinking", 11},
+	{"died", 4}, {"All philosophers have eaten", 27}};
+
+	return (&names[state]);
+}
+
+char	*state_name(t_state state)
+{
+	return ((char *)status_str(state)->str);
+}
+
+static const char	*digit_pairs(void)
+{
+	static const char	pairs[] = "0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+	return (pairs);
+}
+
+/*
+** Writes v in decimal at dst and returns the end. Digits are produced two
+** at a time from a pair table into a scratch buffer, then copied at once.
+*/
+char	*put_uint(char *dst, unsigned long v)
+{
+	const char	*pairs;
+	char		tmp[24];
+	char		*p;
+
+	pairs = digit_pairs();
+	p = tmp + sizeof(tmp);
+	while (v >= 100)
+	{
+		p -= 2;
+		p[0] = pairs[(v % 100) * 2];
+		p[1] = pairs[(v % 100) * 2 + 1];
+		v /= 100;
+	}
+	if (v >= 10)
+	{
+		p -= 2;
+		p[0] = pairs[v * 2];
+		p[1] = pairs[v * 2 + 1];
+	}
+	else
+		*--p = '0' + v;
+	memcpy(dst, p, tmp + sizeof(tmp) - p);
+	return (dst + (tmp + sizeof(tmp) - p));
+}
+
+/*
+** Formats "timestamp id status\n" at dst, which must hold LOG_LINE_MAX
+** bytes, and returns its length. Same bytes as "%ld %d %s\n" for the
+** non-negative values the logger passes. libc memcpy rather than
+** ft_memcpy: libft is built without optimisation and its byte loop
+** alone costs more than the rest of the line.
+*/
+size_t	log_line(char *dst, long ts, int id, t_state state)
+{
+	const t_status_str	*status;
+	char				*p;
+
+	status = status_str(state);
+	p = put_uint(dst, ts);
+	*p++ = ' ';
+	p = put_uint(p, id);
+	*p++ = ' ';
+	memcpy(p, status->str, status->len);
+	p += status->len;
+	*p++ = '\n';
+	return (p - dst);
+}
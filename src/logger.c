@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:13:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** The rings are the one allocation that grows with every philosopher
+** (6 KiB each), so they come from calloc(): fresh zero pages straight from
+** the kernel instead of ft_calloc() touching every byte at startup.
+*/
+int	logger_init(t_table *table)
+{
+	t_logger	*log;
+
+	log = &table->log;
+	log->nrings = table->num_philos + 1;
+	log->capacity = 2 * (size_t)log->nrings * LOG_RING_SIZE;
+	log->rings = calloc(log->nrings, sizeof(t_ring));
+	log->dirty = ft_calloc((log->nrings + 63) / 64, sizeof(atomic_ulong));
+	log->stage = malloc(sizeof(t_event) * log->capacity);
+	log->buf = malloc(LOG_BUF_SIZE);
+	log->staged = 0;
+	log->len = 0;
+	log->stopped = 0;
+	atomic_init(&log->done, 0);
+	if (!log->rings || !log->dirty || !log->stage || !log->buf
+		|| sink_open(table))
+	{
+		logger_destroy(table);
+		return (1);
+	}
+	return (0);
+}
+
+int	logger_start(t_table *table)
+{
+	trace_begin(table);
+	return (pthread_create(&table->log.thread, NULL, logger_routine, table));
+}
+
+void	logger_stop(t_table *table)
+{
+	atomic_store_explicit(&table->log.done, 1, memory_order_release);
+	futex_wake(&table->log.done, 1);
+	pthread_join(table->log.thread, NULL);
+}
+
+void	logger_destroy(t_table *table)
+{
+	unsigned long	dropped;
+	int				i;
+
+	dropped = 0;
+	i = 0;
+	while (table->log.rings && i < table->log.nrings)
+	{
+		dropped += atomic_load(&table->log.rings[i].dropped);
+		i++;
+	}
+	if (dropped)
+	{
+		ft_putstr_fd("philo: ", 2);
+		ft_putnbr_fd((int)dropped, 2);
+		ft_putendl_fd(" log events dropped", 2);
+	}
+	sink_close(&table->log);
+	free(table->log.rings);
+	free(table->log.dirty);
+	free(table->log.stage);
+	free(table->log.buf);
+	table->log.rings = NULL;
+	table->log.dirty = NULL;
+	table->log.stage = NULL;
+	table->log.buf = NULL;
+}
+
+/*
+** full is set by format_event() when the buffer has no room left, clear
+** on the writer's ticks and at the end; backends that batch use it.
+*/
+void	logger_flush(t_logger *log, int full)
+{
+	log->sink->flush(log, full);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger_collect.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:40:50 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:46:37 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Flags ring i as worth draining. Called with the ring's busy flag up and
+** before the event is stamped, so an event older than the watermark can
+** never be missed by a pass that started after it. The pre-check that
+** skips the RMW is seq_cst too: it pairs with the writer's exchange that
+** clears the word, and a relaxed load could be satisfied before our busy
+** store is visible, read a mark already cleared and leave the ring
+** unmarked while the writer sees busy low.
+*/
+void	ring_mark(t_logger *log, int i)
+{
+	atomic_ulong	*word;
+	unsigned long	bit;
+
+	word = &log->dirty[i / 64];
+	bit = 1UL << (i % 64);
+	if (!(atomic_load_explicit(word, memory_order_seq_cst) & bit))
+		atomic_fetch_or_explicit(word, bit, memory_order_seq_cst);
+}
+
+/*
+** A ring the stage had no room for keeps its mark, and the watermark
+** drops to its oldest event left behind so ordering still holds.
+*/
+static t_nsec	collect_ring(t_logger *log, int i, t_nsec wm)
+{
+	t_ring	*ring;
+	t_nsec	left;
+
+	ring = &log->rings[i];
+	ring_wait_idle(ring);
+	log->staged += ring_drain(ring, log->stage + log->staged,
+			log->capacity - log->staged);
+	if (atomic_load(&ring->head) != atomic_load(&ring->tail))
+	{
+		left = ring->slots[atomic_load(&ring->tail) % LOG_RING_SIZE].ts;
+		if (left < wm)
+			wm = left;
+		ring_mark(log, i);
+	}
+	return (wm);
+}
+
+/*
+** Drains every marked ring into the stage. wm is read by the caller before
+** any mark is cleared, so any event not drained yet will carry ts >= wm.
+** Only rings that logged something since the last pass are visited, so a
+** pass costs the number of active philosophers, not the table size.
+*/
+t_nsec	logger_collect(t_table *table, t_nsec wm)
+{
+	t_logger		*log;
+	unsigned long	bits;
+	int				w;
+
+	log = &table->log;
+	w = 0;
+	while (w < (log->nrings + 63) / 64)
+	{
+		bits = 0;
+		if (atomic_load_explicit(&log->dirty[w], memory_order_relaxed))
+			bits = atomic_exchange(&log->dirty[w], 0);
+		while (bits)
+		{
+			wm = collect_ring(log, w * 64 + __builtin_ctzl(bits), wm);
+			bits &= bits - 1;
+		}
+		w++;
+	}
+	return (wm);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger_ring.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:13:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static int	ring_wait_space(t_table *table, t_ring *ring,
+	unsigned long head, t_state state)
+{
+	while (head - atomic_load_explicit(&ring->tail, memory_order_acquire)
+		>= LOG_RING_SIZE)
+	{
+		if (state < ST_DIED
+			&& !atomic_load_explicit(&table->simulation, memory_order_acquire))
+			return (0);
+		if (table->opt.log_policy == LOG_DROP)
+		{
+			atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+			return (0);
+		}
+		if (table->pool && state < ST_DIED)
+			task_sleep(&table->pool->tasks[ring - table->log.rings],
+				now_ns() + 100 * NS_PER_US);
+		else
+			usleep(100);
+	}
+	return (1);
+}
+
+/*
+** busy is raised before the simulation check, so once the writer has seen
+** it low after simulation went to 0, this ring can no longer grow. The
+** final line takes a precise timestamp: under --clock-tick a lagging one
+** could print a death before its deadline.
+*/
+int	ring_push(t_table *table, t_ring *ring, int id, t_state state)
+{
+	unsigned long	head;
+	t_event			*slot;
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	if (!ring_wait_space(table, ring, head, state))
+		return (0);
+	atomic_store_explicit(&ring->busy, 1, memory_order_seq_cst);
+	ring_mark(&table->log, ring - table->log.rings);
+	if (state < ST_DIED
+		&& !atomic_load_explicit(&table->simulation, memory_order_seq_cst))
+	{
+		atomic_store_explicit(&ring->busy, 0, memory_order_release);
+		return (0);
+	}
+	slot = &ring->slots[head % LOG_RING_SIZE];
+	slot->ts = now_ns();
+	if (state >= ST_DIED)
+		slot->ts = now_precise();
+	slot->id = id;
+	slot->seq = (unsigned int)head;
+	slot->state = state;
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+	atomic_store_explicit(&ring->busy, 0, memory_order_release);
+	return (1);
+}
+
+size_t	ring_drain(t_ring *ring, t_event *dst, size_t room)
+{
+	unsigned long	tail;
+	unsigned long	head;
+	size_t			n;
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	n = 0;
+	while (tail + n < head && n < room)
+	{
+		dst[n] = ring->slots[(tail + n) % LOG_RING_SIZE];
+		n++;
+	}
+	atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+	return (n);
+}
+
+void	ring_wait_idle(t_ring *ring)
+{
+	while (atomic_load_explicit(&ring->busy, memory_order_seq_cst))
+		sched_yield();
+}
+
+int	events_have_terminal(t_event *ev, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (ev[i].state >= ST_DIED)
+			return (1);
+		i++;
+	}
+	return (0);
+}
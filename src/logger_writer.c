@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger_writer.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:14:28 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static int	event_cmp(const void *a, const void *b)
+{
+	const t_event	*x;
+	const t_event	*y;
+
+	x = (const t_event *)a;
+	y = (const t_event *)b;
+	if (x->ts != y->ts)
+		return ((x->ts > y->ts) - (x->ts < y->ts));
+	if ((x->state >= ST_DIED) != (y->state >= ST_DIED))
+		return ((x->state >= ST_DIED) - (y->state >= ST_DIED));
+	if (x->id != y->id)
+		return (x->id - y->id);
+	return ((x->seq > y->seq) - (x->seq < y->seq));
+}
+
+static void	emit_until(t_table *table, t_nsec wm)
+{
+	t_logger	*log;
+	size_t		i;
+
+	log = &table->log;
+	i = 0;
+	while (i < log->staged && log->stage[i].ts < wm && !log->stopped)
+	{
+		format_event(table, &log->stage[i]);
+		if (log->stage[i].state >= ST_DIED)
+			log->stopped = 1;
+		i++;
+	}
+	ft_memmove(log->stage, log->stage + i,
+		(log->staged - i) * sizeof(t_event));
+	log->staged -= i;
+}
+
+/*
+** Once a terminal event (died / all ate) shows up, simulation is already 0,
+** so a second collect gathers everything that can still precede it and the
+** writer stops right after printing it.
+*/
+static void	writer_pass(t_table *table, int final)
+{
+	t_logger	*log;
+	int			running;
+	t_nsec		wm;
+
+	log = &table->log;
+	running = atomic_load(&table->simulation);
+	wm = logger_collect(table, now_ns());
+	if (final)
+		wm = INT64_MAX;
+	if (events_have_terminal(log->stage, log->staged))
+	{
+		logger_collect(table, wm);
+		wm = INT64_MAX;
+	}
+	else if (!running && !final)
+		return ;
+	qsort(log->stage, log->staged, sizeof(t_event), event_cmp);
+	emit_until(table, wm);
+}
+
+void	*logger_routine(void *arg)
+{
+	t_table	*table;
+
+	table = (t_table *)arg;
+	while (!table->log.stopped
+		&& !atomic_load_explicit(&table->log.done, memory_order_acquire))
+	{
+		writer_pass(table, 0);
+		logger_flush(&table->log, 0);
+		death_printed(table);
+		futex_wait_until(&table->log.done, 0,
+			now_precise() + LOG_TICK_US * NS_PER_US);
+	}
+	if (!table->log.stopped)
+		writer_pass(table, 1);
+	logger_flush(&table->log, 0);
+	death_printed(table);
+	return (NULL);
+}
@@ -6,42 +6,78 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 06:50:21 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 19:06:18 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:02:50 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
-static int	main_loop(t_table *table)
+/*
+** Main only creates the root of the spawn tree; every philosopher
+** creates its own children, then all of them meet at the start barrier.
+** Returns 1 if some thread could not be created.
+*/
+static int	philos_start(t_table *table)
 {
-	pthread_t	monitor;
-	int			i;
+	int	failed;
 
-	table->start = get_time_ms();
-	table->simulation = 1;
-	i = 0;
-	while (i < table->num_philos)
+	table->spawn.ns = now_precise();
+	if (table->pool)
 	{
-		pthread_create(&table->philo[i].thread, NULL,
-			philo_routine, &table->philo[i]);
-		i++;
+		pool_start(table);
+		failed = start_open(table, table->pool->started);
 	}
-	pthread_create(&monitor, NULL, monitor_routine, table);
-	pthread_join(monitor, NULL);
-	i = 0;
-	while (i < table->num_philos)
+	else
 	{
-		pthread_join(table->philo[i].thread, NULL);
-		i++;
+		table->spawn.root = !spawn_one(table, 0);
+		failed = start_open(table, table->num_philos);
 	}
-	return (0);
+	table->spawn.ns = table->start - table->spawn.ns;
+	if (failed)
+		return_error("Cannot create the philosopher threads");
+	else if (table->stats.philo)
+		spawn_measure(table);
+	return (failed);
 }
 
-static t_table	*init_program(int argc, char **argv)
+static void	philos_join(t_table *table)
+{
+	if (table->pool)
+		pool_join(table);
+	else if (table->spawn.root)
+		pthread_join(table->philo[0].thread, NULL);
+}
+
+static int	main_loop(t_table *table)
+{
+	t_nsec	joined;
+	int		failed;
+
+	table->simulation = 1;
+	if (signals_start(table) || clock_tick_start(table->opt.clock_tick_us)
+		|| logger_start(table))
+		return (1);
+	failed = philos_start(table);
+	if (!failed)
+		monitors_join(table, monitors_start(table));
+	philos_join(table);
+	joined = now_precise();
+	logger_stop(table);
+	clock_tick_stop();
+	signals_stop(table);
+	stats_report(table);
+	if (death_report(table))
+		return_error("Cannot write the death log");
+	if (join_report(table, joined))
+		return_error("Cannot write the join log");
+	return (failed);
+}
+
+static t_table	*init_program(int argc, char **argv, t_options *opt)
 {
 	t_table	*table;
 
-	table = malloc(sizeof(t_table));
+	table = table_alloc(argv, opt);
 	if (!table)
 	{
 		error_exit("Malloc failed\n");
@@ -49,11 +85,16 @@ static t_table	*init_program(int argc, char **argv)
 	}
 	if (parser(argc, argv, table))
 	{
-		free(table);
+		arena_free(table);
 		error_exit("Parser failed\n");
 		return (NULL);
 	}
-	if (init_table(table))
+	table->opt = *opt;
+	if (opt->engine == ENGINE_TASKS)
+		table->opt.forks = FORKS_ODD_EVEN;
+	if ((opt->engine == ENGINE_DES && des_init(table))
+		|| (opt->engine != ENGINE_DES && init_table(table))
+		|| (opt->engine == ENGINE_TASKS && pool_init(table)))
 	{
 		cleanup(table);
 		return (NULL);
@@ -63,17 +104,25 @@ static t_table	*init_program(int argc, char **argv)
 
 int	main(int argc, char **argv)
 {
-	t_table	*table;
+	t_table		*table;
+	t_options	opt;
+	int			status;
 
-	if (validate_args(argc, argv))
+	if (parse_options(&argc, argv, &opt) || validate_args(argc, argv))
 	{
 		error_exit("Invalid args\n");
 		return (1);
 	}
-	table = init_program(argc, argv);
+	clock_setup(opt.clock);
+	sleep_set_tail(opt.sleep_tail_us);
+	table = init_program(argc, argv, &opt);
 	if (!table)
 		return (1);
-	main_loop(table);
+	status = 0;
+	if (opt.engine == ENGINE_DES)
+		des_run(table);
+	else
+		status = main_loop(table);
 	cleanup(table);
-	return (0);
+	return (status);
 }
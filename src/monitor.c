@@ -6,89 +6,109 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:30:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 20:50:43 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:47:14 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
-int	check_death(t_table *table)
+int	monitor_init(t_monitor *mon, t_table *table, int first, int count)
 {
-	int		i;
-	long	now;
-	long	elapsed;
+	int	i;
 
+	mon->table = table;
+	mon->first = first;
+	mon->count = count;
+	mon->next = 0;
+	atomic_init(&mon->wake, 0);
+	if (heap_init(&mon->heap, count))
+		return (1);
 	i = 0;
-	while (i < table->num_philos)
+	while (i < count)
 	{
-		now = get_time_ms();
-		pthread_mutex_lock(&table->data_mutex);
-		elapsed = now - table->philo[i].last_meal;
-		pthread_mutex_unlock(&table->data_mutex);
-		if (elapsed > table->time_to_die)
-		{
-			print_death(table, table->philo[i].id);
-			return (1);
-		}
+		heap_push(&mon->heap, i, atomic_load(&table->hot[first + i].last_meal)
+			+ table->die_ns);
 		i++;
 	}
 	return (0);
 }
 
-static void	print_all_ate(t_table *table)
+/*
+** philo_eat() only publishes last_meal; the heap key of a philosopher is
+** brought up to date when it reaches the top, so a meal costs the monitor
+** one O(log n) re-key and the philosopher nothing.
+*/
+static int	refresh_top(t_monitor *mon, t_nsec *deadline)
 {
-	long	timestamp;
+	t_table	*table;
+	int		item;
+	t_nsec	real;
 
-	timestamp = get_elapsed_time_ms(table->start);
-	pthread_mutex_lock(&table->print_mutex);
-	printf("%ld All philosophers have eaten %d times\n",
-		timestamp, table->meals_required);
-	pthread_mutex_unlock(&table->print_mutex);
+	table = mon->table;
+	while (1)
+	{
+		item = mon->heap.nodes[0].item;
+		real = atomic_load_explicit(&table->hot[mon->first + item].last_meal,
+				memory_order_acquire) + table->die_ns;
+		if (real == mon->heap.nodes[0].key)
+			break ;
+		heap_update(&mon->heap, item, real);
+	}
+	*deadline = real;
+	return (item);
 }
 
-int	check_all_ate(t_table *table)
+int	check_death(t_monitor *mon)
 {
-	int	i;
+	t_nsec	deadline;
+	t_nsec	now;
+	int		item;
 
-	if (table->meals_required == -1)
-		return (0);
-	pthread_mutex_lock(&table->data_mutex);
-	i = 0;
-	while (i < table->num_philos)
+	item = refresh_top(mon, &deadline);
+	now = now_precise();
+	if (now >= deadline)
 	{
-		if (table->philo[i].meals_eaten < table->meals_required)
-		{
-			pthread_mutex_unlock(&table->data_mutex);
-			return (0);
-		}
-		i++;
+		print_death(mon->table, mon->table->philo[mon->first + item].id,
+			deadline, now);
+		return (1);
 	}
+	mon->next = deadline;
+	return (0);
+}
+
+int	check_all_ate(t_table *table)
+{
+	if (table->meals_required == -1)
+		return (0);
+	if (atomic_load_explicit(&table->full_count, memory_order_acquire)
+		< table->num_philos)
+		return (0);
 	print_all_ate(table);
-	pthread_mutex_unlock(&table->data_mutex);
 	return (1);
 }
 
+/*
+** Sleeps until the earliest deadline on the wait-on-sequence pattern:
+** wake is loaded before anything is checked, so a philosopher getting
+** full after the check still changes the word the futex compares
+** against, and the sleep returns at once. A meal needs no wakeup: it
+** only ever moves a deadline later, never before the one we sleep to.
+*/
 void	*monitor_routine(void *arg)
 {
-	t_table	*table;
-	int		running;
+	t_monitor	*mon;
+	t_table		*table;
+	int			seen;
 
-	table = (t_table *)arg;
-	while (1)
+	mon = (t_monitor *)arg;
+	table = mon->table;
+	pin_to_shard(table, mon - table->monitors);
+	while (atomic_load_explicit(&table->simulation, memory_order_acquire))
 	{
-		pthread_mutex_lock(&table->data_mutex);
-		running = table->simulation;
-		pthread_mutex_unlock(&table->data_mutex);
-		if (running == 0)
-			break ;
-		if (check_death(table) || check_all_ate(table))
-		{
-			pthread_mutex_lock(&table->data_mutex);
-			table->simulation = 0;
-			pthread_mutex_unlock(&table->data_mutex);
+		seen = atomic_load(&mon->wake);
+		if (check_death(mon) || check_all_ate(table))
 			break ;
-		}
-		usleep(1000);
+		futex_wait_until(&mon->wake, seen, mon->next);
 	}
 	return (NULL);
 }
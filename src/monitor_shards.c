@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monitor_shards.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:21:09 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:21:09 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** One monitor per MONITOR_SHARD_MIN philosophers, never more than the
+** online cores; --monitors=K overrides it.
+*/
+static int	monitor_count(t_table *table)
+{
+	long	k;
+
+	k = table->opt.monitors;
+	if (k <= 0)
+	{
+		k = (table->num_philos + MONITOR_SHARD_MIN - 1) / MONITOR_SHARD_MIN;
+		if (k > cpu_count())
+			k = cpu_count();
+	}
+	if (k > table->num_philos)
+		k = table->num_philos;
+	if (k < 1)
+		k = 1;
+	return ((int)k);
+}
+
+int	monitors_init(t_table *table)
+{
+	int	k;
+	int	first;
+	int	end;
+
+	table->num_monitors = monitor_count(table);
+	table->monitors = ft_calloc(table->num_monitors, sizeof(t_monitor));
+	if (!table->monitors)
+		return (1);
+	k = 0;
+	while (k < table->num_monitors)
+	{
+		first = (long)k * table->num_philos / table->num_monitors;
+		end = (long)(k + 1) * table->num_philos / table->num_monitors;
+		if (monitor_init(&table->monitors[k], table, first, end - first))
+			return (1);
+		while (first < end)
+		{
+			table->philo[first].shard = k;
+			first++;
+		}
+		k++;
+	}
+	return (0);
+}
+
+void	monitors_free(t_table *table)
+{
+	int	k;
+
+	k = 0;
+	while (table->monitors && k < table->num_monitors)
+	{
+		heap_free(&table->monitors[k].heap);
+		k++;
+	}
+	free(table->monitors);
+	table->monitors = NULL;
+}
+
+int	monitors_start(t_table *table)
+{
+	int	k;
+
+	k = 0;
+	while (k < table->num_monitors)
+	{
+		if (pthread_create(&table->monitors[k].thread, NULL, monitor_routine,
+				&table->monitors[k]))
+			return (k);
+		k++;
+	}
+	return (k);
+}
+
+void	monitors_join(t_table *table, int started)
+{
+	int	k;
+
+	k = 0;
+	while (k < started)
+	{
+		pthread_join(table->monitors[k].thread, NULL);
+		k++;
+	}
+}
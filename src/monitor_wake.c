@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monitor_wake.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:07:38 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:47:14 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** The sequence bump comes before the wake: a monitor that loaded wake
+** before the bump finds the word changed and does not go to sleep.
+*/
+void	monitor_wake(t_monitor *mon)
+{
+	atomic_fetch_add(&mon->wake, 1);
+	futex_wake(&mon->wake, 1);
+}
+
+void	monitors_wake(t_table *table)
+{
+	int	k;
+
+	k = 0;
+	while (table->monitors && k < table->num_monitors)
+	{
+		monitor_wake(&table->monitors[k]);
+		k++;
+	}
+}
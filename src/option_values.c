@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   option_values.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:16:20 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:58:35 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	opt_log_policy(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "block", 6) == 0)
+		opt->log_policy = LOG_BLOCK;
+	else if (ft_strncmp(val, "drop", 5) == 0)
+		opt->log_policy = LOG_DROP;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_clock(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "mono", 5) == 0)
+		opt->clock = CLK_MONO;
+	else if (ft_strncmp(val, "coarse", 7) == 0)
+		opt->clock = CLK_COARSE;
+	else if (ft_strncmp(val, "tsc", 4) == 0)
+		opt->clock = CLK_TSC;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_sleep_tail(t_options *opt, char *val)
+{
+	return (option_number(val, &opt->sleep_tail_us));
+}
+
+int	opt_monitors(t_options *opt, char *val)
+{
+	return (option_number(val, &opt->monitors));
+}
+
+int	opt_forks(t_options *opt, char *val)
+{
+	const char	*name;
+	int			mode;
+
+	mode = 0;
+	while (mode < FORKS_COUNT)
+	{
+		name = strategy_of(mode)->name;
+		if (ft_strncmp(val, name, ft_strlen(name) + 1) == 0)
+		{
+			opt->forks = mode;
+			return (0);
+		}
+		mode++;
+	}
+	return (1);
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   option_values_out.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:18:13 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	opt_sink(t_options *opt, char *val)
+{
+	const char	*name;
+	int			mode;
+
+	mode = 0;
+	while (mode < SINKS_COUNT)
+	{
+		name = sink_of(mode)->name;
+		if (ft_strncmp(val, name, ft_strlen(name) + 1) == 0)
+		{
+			opt->sink = mode;
+			return (0);
+		}
+		mode++;
+	}
+	return (1);
+}
+
+int	opt_clock_tick(t_options *opt, char *val)
+{
+	return (option_number(val, &opt->clock_tick_us));
+}
+
+int	opt_join_log(t_options *opt, char *val)
+{
+	if (!*val)
+		return (1);
+	opt->join_log = val;
+	return (0);
+}
+
+/*
+** In KiB; 0 keeps the default stack, anything else must fit the
+** smallest stack pthreads accepts.
+*/
+int	opt_stack_size(t_options *opt, char *val)
+{
+	if (option_number(val, &opt->stack_kib))
+		return (1);
+	return (opt->stack_kib && opt->stack_kib * 1024 < PTHREAD_STACK_MIN);
+}
+
+int	opt_hugepages(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "off", 4) == 0)
+		opt->hugepages = HUGE_OFF;
+	else if (ft_strncmp(val, "thp", 4) == 0)
+		opt->hugepages = HUGE_THP;
+	else if (ft_strncmp(val, "hugetlb", 8) == 0)
+		opt->hugepages = HUGE_TLB;
+	else
+		return (1);
+	return (0);
+}
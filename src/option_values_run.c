@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   option_values_run.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:27:53 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:09:03 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+int	opt_engine(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "threads", 8) == 0)
+		opt->engine = ENGINE_THREADS;
+	else if (ft_strncmp(val, "des", 4) == 0)
+		opt->engine = ENGINE_DES;
+	else if (ft_strncmp(val, "tasks", 6) == 0)
+		opt->engine = ENGINE_TASKS;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_seed(t_options *opt, char *val)
+{
+	return (option_number(val, &opt->seed));
+}
+
+int	opt_death_log(t_options *opt, char *val)
+{
+	if (!*val)
+		return (1);
+	opt->death_log = val;
+	return (0);
+}
+
+int	opt_stats(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "on", 3) == 0)
+		opt->stats = 1;
+	else if (ft_strncmp(val, "off", 4) == 0)
+		opt->stats = 0;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_trace(t_options *opt, char *val)
+{
+	if (ft_strncmp(val, "text", 5) == 0)
+		opt->trace = TRACE_TEXT;
+	else if (ft_strncmp(val, "binary", 7) == 0)
+		opt->trace = TRACE_BINARY;
+	else if (ft_strncmp(val, "none", 5) == 0)
+		opt->trace = TRACE_NONE;
+	else
+		return (1);
+	return (0);
+}
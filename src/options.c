@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:13:36 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:51:42 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static const t_optdef	*option_defs(void)
+{
+	static const t_optdef	defs[] = {
+	{"--log-policy=", opt_log_policy},
+	{"--clock=", opt_clock},
+	{"--sleep-tail=", opt_sleep_tail},
+	{"--monitors=", opt_monitors},
+	{"--forks=", opt_forks},
+	{"--engine=", opt_engine},
+	{"--seed=", opt_seed},
+	{"--death-log=", opt_death_log},
+	{"--stats=", opt_stats},
+	{"--trace=", opt_trace},
+	{"--sink=", opt_sink},
+	{"--clock-tick=", opt_clock_tick},
+	{"--join-log=", opt_join_log},
+	{"--stack-size=", opt_stack_size},
+	{"--hugepages=", opt_hugepages},
+	{NULL, NULL}
+	};
+
+	return (defs);
+}
+
+static void	default_options(t_options *opt)
+{
+	opt->log_policy = LOG_BLOCK;
+	opt->clock = CLK_MONO;
+	opt->sleep_tail_us = SLEEP_TAIL_US;
+	opt->monitors = 0;
+	opt->forks = FORKS_ODD_EVEN;
+	opt->engine = ENGINE_THREADS;
+	opt->seed = 0;
+	opt->death_log = NULL;
+	opt->stats = 0;
+	opt->trace = TRACE_TEXT;
+	opt->sink = SINK_WRITE;
+	opt->clock_tick_us = 0;
+	opt->join_log = NULL;
+	opt->stack_kib = PHILO_STACK_KIB;
+	opt->hugepages = HUGE_OFF;
+}
+
+/*
+** Parses a plain non-negative decimal of at most 9 digits.
+*/
+int	option_number(char *val, long *out)
+{
+	int	i;
+
+	i = 0;
+	while (val[i] >= '0' && val[i] <= '9')
+		i++;
+	if (i == 0 || val[i] != '\0' || i > 9)
+		return (1);
+	*out = ft_atol(val);
+	return (0);
+}
+
+static int	apply_option(char *arg, t_options *opt)
+{
+	const t_optdef	*def;
+	size_t			len;
+
+	def = option_defs();
+	while (def->name)
+	{
+		len = ft_strlen(def->name);
+		if (ft_strncmp(arg, def->name, len) == 0)
+		{
+			if (def->parse(opt, arg + len) == 0)
+				return (0);
+			ft_printf("Error: Invalid value for option %s\n", arg);
+			return (1);
+		}
+		def++;
+	}
+	ft_printf("Error: Unknown option %s\n", arg);
+	return (1);
+}
+
+/*
+** Consumes every "--name=value" argument and compacts the positional ones,
+** so validate_args() and parser() keep seeing the classic argv layout.
+*/
+int	parse_options(int *ac, char **av, t_options *opt)
+{
+	int	i;
+	int	j;
+
+	default_options(opt);
+	i = 1;
+	j = 1;
+	while (i < *ac)
+	{
+		if (ft_strncmp(av[i], "--", 2) == 0)
+		{
+			if (apply_option(av[i], opt))
+				return (1);
+		}
+		else
+		{
+			av[j] = av[i];
+			j++;
+		}
+		i++;
+	}
+	av[j] = NULL;
+	*ac = j;
+	return (0);
+}
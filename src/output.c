@@ -6,38 +6,86 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:30:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 17:00:26 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:04:34 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
-void	print_status(t_table *table, int philo_id, char *status)
+/*
+** Every state change also goes to the flight recorder, with the timestamp
+** of the log record when there is one so the clock is read only once. An
+** event the log could not take (--trace=none, or dropped from a full
+** ring) is still recorded, unless the run has already ended: the same
+** check ring_push() makes, so the recorder never shows events after the
+** final line.
+*/
+void	print_status(t_table *table, int philo_id, t_state state)
 {
-	long	timestamp;
+	t_ring	*ring;
+	t_nsec	ts;
 
-	pthread_mutex_lock(&table->data_mutex);
-	if (table->simulation == 0)
-	{
-		pthread_mutex_unlock(&table->data_mutex);
+	ring = &table->log.rings[philo_id - 1];
+	if (table->opt.trace != TRACE_NONE
+		&& ring_push(table, ring, philo_id, state))
+		ts = ring->slots[(atomic_load_explicit(&ring->head,
+						memory_order_relaxed) - 1) % LOG_RING_SIZE].ts;
+	else if (atomic_load_explicit(&table->simulation, memory_order_acquire))
+		ts = now_ns();
+	else
 		return ;
-	}
-	pthread_mutex_unlock(&table->data_mutex);
-	pthread_mutex_lock(&table->print_mutex);
-	timestamp = get_elapsed_time_ms(table->start);
-	printf("%ld %d %s\n", timestamp, philo_id, status);
-	pthread_mutex_unlock(&table->print_mutex);
+	flight_record(&table->flight[philo_id - 1], ts, state);
 }
 
-void	print_death(t_table *table, int philo_id)
+/*
+** deadline is the monitor's (last_meal + die_ns), seen the clock reading
+** that found it passed; both are kept for death_report(). The dump is
+** best-effort: it runs while the other philosophers are still going.
+** The run has already ended, so they stop recording, but one that passed
+** its check just before may still add an event during the dump. Each
+** slot is read under its seqlock, so entries are whole, but the set of
+** entries may be one event short or long per philosopher.
+*/
+void	print_death(t_table *table, int philo_id, t_nsec deadline, t_nsec seen)
 {
-	long	timestamp;
+	if (!end_simulation(table))
+		return ;
+	table->death.deadline = deadline - table->die_ns
+		+ table->time_to_die * NS_PER_MS;
+	table->death.detected = seen;
+	ring_push(table, &table->log.rings[table->num_philos], philo_id, ST_DIED);
+	flight_dump(table, philo_id, "died");
+}
 
-	timestamp = get_elapsed_time_ms(table->start);
-	pthread_mutex_lock(&table->data_mutex);
-	table->simulation = 0;
-	pthread_mutex_unlock(&table->data_mutex);
-	pthread_mutex_lock(&table->print_mutex);
-	printf("%ld %d died\n", timestamp, philo_id);
-	pthread_mutex_unlock(&table->print_mutex);
+void	print_all_ate(t_table *table)
+{
+	if (!end_simulation(table))
+		return ;
+	ring_push(table, &table->log.rings[table->num_philos], 0, ST_ALL_ATE);
+}
+
+/*
+** Called by the writer thread only, formats one record into its buffer,
+** as a text line or as a binary trace record.
+*/
+void	format_event(t_table *table, t_event *ev)
+{
+	t_logger	*log;
+	long		ts;
+
+	log = &table->log;
+	if (log->len + LOG_LINE_MAX > LOG_BUF_SIZE)
+		logger_flush(log, 1);
+	if (table->opt.trace == TRACE_BINARY)
+	{
+		trace_event(table, ev);
+		return ;
+	}
+	ts = (long)((ev->ts - table->start) / NS_PER_MS);
+	if (ev->state == ST_ALL_ATE)
+		log->len += ft_snprintf(log->buf + log->len, LOG_LINE_MAX,
+				"%ld All philosophers have eaten %d times\n",
+				ts, table->meals_required);
+	else
+		log->len += log_line(log->buf + log->len, ts, ev->id, ev->state);
 }
@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:30:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 20:50:43 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:45:25 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,14 +14,13 @@
 
 static int	check_simulation(t_table *table)
 {
-	int	running;
-
-	pthread_mutex_lock(&table->data_mutex);
-	running = table->simulation;
-	pthread_mutex_unlock(&table->data_mutex);
-	return (running);
+	return (atomic_load_explicit(&table->simulation, memory_order_acquire));
 }
 
+/*
+** Even ids give their odd neighbours a head start counted from the
+** shared epoch (see start_offset()).
+*/
 void	*philo_routine(void *arg)
 {
 	t_philo	*philo;
@@ -29,12 +28,14 @@ void	*philo_routine(void *arg)
 
 	philo = (t_philo *)arg;
 	table = philo->table;
-	if (philo->id % 2 == 0)
-		usleep(1000);
+	if (start_offset(table, philo->id))
+		philo_wait_until(table, philo->id, table->start
+			+ start_offset(table, philo->id));
 	while (check_simulation(table))
 	{
 		philo_think(table, philo->id);
-		take_forks(philo, table);
+		if (!take_forks(philo, table))
+			break ;
 		philo_eat(philo, table);
 		drop_forks(philo);
 		philo_sleep(table, philo->id);
@@ -42,35 +43,59 @@ void	*philo_routine(void *arg)
 	return (NULL);
 }
 
-void	take_forks(t_philo *philo, t_table *table)
+/*
+** A lone philosopher holds its only fork until the monitor ends the run,
+** asleep on the simulation word that end_simulation() wakes.
+*/
+static int	take_only_fork(t_philo *philo, t_table *table)
 {
-	if (table->num_philos == 1)
+	pthread_mutex_lock(philo->fork_left);
+	print_status(table, philo->id, ST_FORK);
+	if (table->pool)
 	{
-		pthread_mutex_lock(philo->fork_left);
-		print_status(table, philo->id, "has taken a fork");
 		while (check_simulation(table))
-			usleep(1000);
-		pthread_mutex_unlock(philo->fork_left);
-		return ;
-	}
-	if (philo->id % 2 == 0)
-	{
-		pthread_mutex_lock(philo->fork_right);
-		print_status(table, philo->id, "has taken a fork");
-		pthread_mutex_lock(philo->fork_left);
-		print_status(table, philo->id, "has taken a fork");
+			philo_wait(table, philo->id, 1);
 	}
 	else
 	{
-		pthread_mutex_lock(philo->fork_left);
-		print_status(table, philo->id, "has taken a fork");
-		pthread_mutex_lock(philo->fork_right);
-		print_status(table, philo->id, "has taken a fork");
+		while (check_simulation(table))
+			futex_wait(&table->simulation, 1);
 	}
+	pthread_mutex_unlock(philo->fork_left);
+	return (0);
+}
+
+/*
+** Returns 0 when the run ended while waiting, with no fork held. With
+** --stats=on the time spent here goes to the fork-wait histogram.
+*/
+int	take_forks(t_philo *philo, t_table *table)
+{
+	t_nsec	start;
+	int		taken;
+
+	start = 0;
+	if (table->stats.philo)
+		start = now_ns();
+	taken = 1;
+	if (table->num_philos == 1)
+		taken = take_only_fork(philo, table);
+	else if (table->pool)
+		task_take_forks(philo, table);
+	else
+		taken = table->strategy->acquire(philo, table);
+	if (table->stats.philo)
+		hist_record(&table->stats.philo[philo->id - 1].h[STAT_WAIT],
+			now_ns() - start);
+	return (taken);
 }
 
 void	drop_forks(t_philo *philo)
 {
-	pthread_mutex_unlock(philo->fork_left);
-	pthread_mutex_unlock(philo->fork_right);
+	if (philo->table->num_philos == 1)
+		return ;
+	if (philo->table->pool)
+		task_drop_forks(philo, philo->table);
+	else
+		philo->table->strategy->release(philo, philo->table);
 }
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:33:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:41:24 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static int	pool_alloc(t_pool *pool, int n)
+{
+	t_worker	*w;
+	int			i;
+
+	pool->nworkers = cpu_count();
+	if (pool->nworkers > n)
+		pool->nworkers = n;
+	pool->tasks = ft_calloc(n, sizeof(t_task));
+	pool->forks = cache_alloc(n, sizeof(t_task_fork));
+	pool->workers = ft_calloc(pool->nworkers, sizeof(t_worker));
+	if (!pool->tasks || !pool->forks || !pool->workers)
+		return (1);
+	i = 0;
+	while (i < pool->nworkers)
+	{
+		w = &pool->workers[i];
+		w->pool = pool;
+		w->index = i;
+		pthread_mutex_init(&w->ready.lock, NULL);
+		w->ready.cap = n;
+		w->ready.slots = malloc(sizeof(t_task *) * n);
+		if (!w->ready.slots || heap_init(&w->timers, n))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*
+** Every stack is a slice of one MAP_NORESERVE mapping: only the pages a
+** task touches are ever backed, and 100k tasks stay one VMA instead of
+** running into vm.max_map_count. The price is no guard page per stack.
+*/
+int	pool_init(t_table *table)
+{
+	t_pool	*pool;
+	int		i;
+
+	pool = ft_calloc(1, sizeof(t_pool));
+	table->pool = pool;
+	if (!pool || pool_alloc(pool, table->num_philos))
+		return (1);
+	pool->table = table;
+	pool->stacks_len = (size_t)table->num_philos * TASK_STACK_SIZE;
+	pool->stacks = mmap(NULL, pool->stacks_len, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+	if (pool->stacks == MAP_FAILED)
+	{
+		pool->stacks = NULL;
+		return (1);
+	}
+	i = 0;
+	while (i < table->num_philos)
+	{
+		pool->tasks[i].philo = &table->philo[i];
+		i++;
+	}
+	return (0);
+}
+
+void	pool_free(t_table *table)
+{
+	t_pool	*pool;
+	int		i;
+
+	pool = table->pool;
+	if (!pool)
+		return ;
+	i = 0;
+	while (pool->workers && i < pool->nworkers)
+	{
+		pthread_mutex_destroy(&pool->workers[i].ready.lock);
+		free(pool->workers[i].ready.slots);
+		heap_free(&pool->workers[i].timers);
+		i++;
+	}
+	if (pool->stacks)
+		munmap(pool->stacks, pool->stacks_len);
+	free(pool->workers);
+	free(pool->tasks);
+	free(pool->forks);
+	free(pool);
+	table->pool = NULL;
+}
+
+/*
+** Philosophers are dealt to workers in contiguous blocks so neighbours,
+** and the forks they hand to each other, mostly stay on one worker. A
+** worker that fails to start just leaves its queue to be stolen from.
+*/
+int	pool_start(t_table *table)
+{
+	t_pool	*pool;
+	int		i;
+
+	pool = table->pool;
+	atomic_store(&pool->live, table->num_philos);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		deque_push(&pool->workers[(long)i * pool->nworkers
+			/ table->num_philos].ready, &pool->tasks[i]);
+		i++;
+	}
+	while (pool->started < pool->nworkers)
+	{
+		if (pthread_create(&pool->workers[pool->started].thread, NULL,
+				worker_routine, &pool->workers[pool->started]))
+			break ;
+		pool->started++;
+	}
+	return (pool->started == 0);
+}
+
+/*
+** Called by end_simulation(): every idle worker wakes up, and since the
+** run is over, fire_timers() treats each parked timer as due, so tasks
+** asleep in task_sleep() exit now instead of at their deadline.
+*/
+void	pool_stop(t_table *table)
+{
+	if (!table->pool)
+		return ;
+	atomic_fetch_add(&table->pool->signal, 1);
+	futex_wake(&table->pool->signal, INT_MAX);
+}
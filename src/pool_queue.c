@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_queue.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:33:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:42:18 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+void	deque_push(t_deque *dq, t_task *task)
+{
+	pthread_mutex_lock(&dq->lock);
+	dq->slots[dq->tail % dq->cap] = task;
+	dq->tail++;
+	pthread_mutex_unlock(&dq->lock);
+}
+
+t_task	*deque_pop(t_deque *dq)
+{
+	t_task	*task;
+
+	task = NULL;
+	pthread_mutex_lock(&dq->lock);
+	if (dq->head < dq->tail)
+	{
+		task = dq->slots[dq->head % dq->cap];
+		dq->head++;
+	}
+	pthread_mutex_unlock(&dq->lock);
+	return (task);
+}
+
+/*
+** Thieves never wait on a queue lock: a busy queue is skipped and the
+** next victim is tried.
+*/
+t_task	*deque_steal(t_deque *dq)
+{
+	t_task	*task;
+
+	if (pthread_mutex_trylock(&dq->lock))
+		return (NULL);
+	task = NULL;
+	if (dq->head < dq->tail)
+	{
+		dq->tail--;
+		task = dq->slots[dq->tail % dq->cap];
+	}
+	pthread_mutex_unlock(&dq->lock);
+	return (task);
+}
+
+/*
+** Queues task on worker and, if somebody is idle, bumps signal so one
+** sleeper wakes up to steal it.
+*/
+void	pool_ready(t_worker *worker, t_task *task)
+{
+	t_pool	*pool;
+
+	pool = worker->pool;
+	deque_push(&worker->ready, task);
+	if (atomic_load(&pool->idle) > 0)
+	{
+		atomic_fetch_add(&pool->signal, 1);
+		futex_wake(&pool->signal, 1);
+	}
+}
+
+t_task	*worker_next(t_worker *worker)
+{
+	t_pool	*pool;
+	t_task	*task;
+	int		k;
+
+	pool = worker->pool;
+	task = deque_pop(&worker->ready);
+	k = 1;
+	while (!task && k < pool->nworkers)
+	{
+		task = deque_steal(&pool->workers[(worker->index + k)
+				% pool->nworkers].ready);
+		k++;
+	}
+	return (task);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_worker.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:33:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:41:24 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Once the run has ended every timer is due: the whole heap goes back to
+** the run queue and the tasks see the end at once.
+*/
+static void	fire_timers(t_worker *worker)
+{
+	t_nsec	now;
+
+	if (!worker->timers.size)
+		return ;
+	now = now_ns();
+	if (!atomic_load_explicit(&worker->pool->table->simulation,
+			memory_order_acquire))
+		now = INT64_MAX;
+	while (worker->timers.size && worker->timers.nodes[0].key <= now)
+		pool_ready(worker, &worker->pool->tasks[heap_pop(&worker->timers)]);
+}
+
+/*
+** Resumes task until it parks again, then finishes the park from the
+** scheduler's stack, where the task's context is already fully saved.
+** A task's stack is laid out on its first run, so startup touches none.
+*/
+static void	run_task(t_worker *worker, t_task *task)
+{
+	t_pool	*pool;
+
+	pool = worker->pool;
+	task->worker = worker;
+	if (!task->started)
+		task_ctx_init(task, pool->stacks
+			+ (size_t)(task->philo->id - 1) * TASK_STACK_SIZE);
+	task_ctx_switch(&worker->sched, &task->ctx);
+	if (task->park == PARK_TIMER)
+		heap_push(&worker->timers, task->philo->id - 1, task->wake);
+	else if (task->park == PARK_FORK)
+		task_fork_park(worker, task);
+	else if (atomic_fetch_sub(&pool->live, 1) == 1)
+	{
+		atomic_fetch_add(&pool->signal, 1);
+		futex_wake(&pool->signal, INT_MAX);
+	}
+}
+
+/*
+** Nothing runnable. idle is raised before looking once more, so a push
+** that saw idle == 0 is found here and a later one bumps signal. The
+** futex sleep stops short of the next timer by the sleep tail, which is
+** then finished by yielding, the same way sleep_until() does it. A
+** worker with timers left after the run ended does not sleep at all:
+** pool_stop() may have bumped signal before seq was read.
+*/
+static void	worker_idle(t_worker *worker)
+{
+	t_pool	*pool;
+	t_task	*task;
+	t_nsec	until;
+	int		seq;
+
+	pool = worker->pool;
+	seq = atomic_load(&pool->signal);
+	atomic_fetch_add(&pool->idle, 1);
+	task = worker_next(worker);
+	until = now_ns() + POOL_IDLE_US * NS_PER_US;
+	if (worker->timers.size && worker->timers.nodes[0].key < until)
+		until = worker->timers.nodes[0].key;
+	until -= *sleep_tail();
+	if (worker->timers.size && !atomic_load_explicit(
+			&pool->table->simulation, memory_order_acquire))
+		until = 0;
+	if (!task && atomic_load(&pool->live) > 0 && now_ns() < until)
+		futex_wait_until(&pool->signal, seq, until);
+	else if (!task)
+		sched_yield();
+	atomic_fetch_sub(&pool->idle, 1);
+	if (task)
+		run_task(worker, task);
+}
+
+void	*worker_routine(void *arg)
+{
+	t_worker	*worker;
+	t_task		*task;
+
+	worker = (t_worker *)arg;
+	start_wait(worker->pool->table);
+	while (atomic_load(&worker->pool->live) > 0)
+	{
+		fire_timers(worker);
+		task = worker_next(worker);
+		if (task)
+			run_task(worker, task);
+		else
+			worker_idle(worker);
+	}
+	return (NULL);
+}
+
+void	pool_join(t_table *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->pool->started)
+	{
+		pthread_join(table->pool->workers[i].thread, NULL);
+		i++;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/06 17:16:13 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 19:54:44 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:47:14 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,21 +14,54 @@
 
 void	philo_eat(t_philo *philo, t_table *table)
 {
-	pthread_mutex_lock(&table->data_mutex);
-	philo->last_meal = get_time_ms();
-	philo->meals_eaten++;
-	pthread_mutex_unlock(&table->data_mutex);
-	print_status(table, philo->id, "is eating");
-	ft_usleep(table->time_to_eat);
+	t_nsec	now;
+	int		meals;
+
+	now = now_precise();
+	if (table->stats.philo)
+		stats_meal(philo, table, now - atomic_load_explicit(
+				&philo->hot->last_meal, memory_order_relaxed));
+	atomic_store_explicit(&philo->hot->last_meal, now, memory_order_release);
+	meals = atomic_load_explicit(&philo->hot->meals_eaten,
+			memory_order_relaxed);
+	atomic_store_explicit(&philo->hot->meals_eaten, meals + 1,
+		memory_order_release);
+	if (meals + 1 == table->meals_required)
+	{
+		atomic_fetch_add(&table->full_count, 1);
+		monitor_wake(&table->monitors[philo->shard]);
+	}
+	print_status(table, philo->id, ST_EAT);
+	philo_wait(table, philo->id, table->time_to_eat);
+}
+
+/*
+** Sleeps on behalf of a philosopher until an absolute deadline: a timer
+** plus a task switch under the task engine, the hybrid kernel sleep
+** otherwise, cut short when the run ends.
+*/
+void	philo_wait_until(t_table *table, int philo_id, t_nsec deadline)
+{
+	if (table->pool)
+		task_sleep(&table->pool->tasks[philo_id - 1], deadline);
+	else
+		sleep_until(deadline, &table->simulation);
+}
+
+void	philo_wait(t_table *table, int philo_id, long msecs)
+{
+	philo_wait_until(table, philo_id, now_precise() + msecs * NS_PER_MS);
 }
 
 void	philo_sleep(t_table *table, int philo_id)
 {
-	print_status(table, philo_id, "is sleeping");
-	ft_usleep(table->time_to_sleep);
+	print_status(table, philo_id, ST_SLEEP);
+	philo_wait(table, philo_id, table->time_to_sleep);
 }
 
 void	philo_think(t_table *table, int philo_id)
 {
-	print_status(table, philo_id, "is thinking");
+	print_status(table, philo_id, ST_THINK);
+	if (table->strategy->on_think)
+		table->strategy->on_think(&table->philo[philo_id - 1], table);
 }
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   signals.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:03:50 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:09:03 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** SIGUSR1 and SIGUSR2 are blocked in every thread and taken with sigwait()
+** here, so the dumps run as ordinary code instead of in a signal handler.
+*/
+static void	*signal_routine(void *arg)
+{
+	t_table		*table;
+	sigset_t	set;
+	int			sig;
+
+	table = (t_table *)arg;
+	sigemptyset(&set);
+	sigaddset(&set, SIGUSR1);
+	sigaddset(&set, SIGUSR2);
+	while (sigwait(&set, &sig) == 0
+		&& !atomic_load_explicit(&table->signals.done, memory_order_acquire))
+	{
+		if (sig == SIGUSR1)
+			flight_dump_likely(table);
+		else
+			stats_report(table);
+	}
+	return (NULL);
+}
+
+/*
+** Must run before any other thread is created: they inherit the mask.
+*/
+int	signals_start(t_table *table)
+{
+	sigset_t	set;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGUSR1);
+	sigaddset(&set, SIGUSR2);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+	if (pthread_create(&table->signals.thread, NULL, signal_routine, table))
+		return (1);
+	table->signals.running = 1;
+	return (0);
+}
+
+void	signals_stop(t_table *table)
+{
+	if (!table->signals.running)
+		return ;
+	atomic_store_explicit(&table->signals.done, 1, memory_order_release);
+	pthread_kill(table->signals.thread, SIGUSR1);
+	pthread_join(table->signals.thread, NULL);
+	table->signals.running = 0;
+}
@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simulation.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:21:20 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:41:24 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Only the monitor that flips simulation from 1 to 0 gets to print the
+** final line. Everyone else is woken at once: philosophers sleeping on
+** the simulation word, the strategy's own waiters through its stop hook,
+** the task pool's idle workers and the other monitors on their wake
+** words.
+*/
+int	end_simulation(t_table *table)
+{
+	int	running;
+
+	running = 1;
+	if (!atomic_compare_exchange_strong(&table->simulation, &running, 0))
+		return (0);
+	table->stop_at = now_precise();
+	futex_wake(&table->simulation, INT_MAX);
+	if (table->strategy && table->strategy->stop)
+		table->strategy->stop(table);
+	pool_stop(table);
+	monitors_wake(table);
+	return (1);
+}
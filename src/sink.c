@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:17:12 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Every output backend, indexed by t_sink_mode.
+*/
+const t_sink	*sink_of(t_sink_mode mode)
+{
+	static const t_sink	list[SINKS_COUNT] = {
+	[SINK_WRITE] = {"write", NULL, write_flush, NULL},
+	[SINK_WRITEV] = {"writev", writev_open, writev_flush, writev_close},
+	[SINK_MMAP] = {"mmap", mmap_open, mmap_flush, mmap_close},
+	[SINK_URING] = {"uring", uring_open, uring_flush, uring_close}
+	};
+
+	return (&list[mode]);
+}
+
+/*
+** Opens the --sink backend once log->buf exists. A backend the kernel or
+** stdout cannot support (mmap on a pipe, io_uring disabled) falls back to
+** plain write(2) with a note on stderr.
+*/
+int	sink_open(t_table *table)
+{
+	t_logger	*log;
+
+	log = &table->log;
+	log->sink = sink_of(table->opt.sink);
+	if (!log->sink->open || log->sink->open(log) == 0)
+		return (0);
+	ft_dprintf(2, "philo: --sink=%s unavailable, using write\n",
+		log->sink->name);
+	log->sink = sink_of(SINK_WRITE);
+	return (0);
+}
+
+void	sink_close(t_logger *log)
+{
+	if (!log->sink)
+		return ;
+	log->sink->flush(log, 0);
+	if (log->sink->close)
+		log->sink->close(log);
+	log->sink = NULL;
+}
+
+void	write_flush(t_logger *log, int full)
+{
+	size_t	off;
+	ssize_t	ret;
+
+	(void)full;
+	off = 0;
+	while (off < log->len)
+	{
+		ret = write(1, log->buf + off, log->len - off);
+		if (ret <= 0)
+			break ;
+		off += ret;
+	}
+	log->len = 0;
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_mmap.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:17:26 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:03:46 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Makes the file at least need bytes long past map_off, never more, so
+** whatever way the process ends the log is not padded with NULs. The
+** mapping itself grows in SINK_MAP_CHUNK steps: pages past the end of
+** the file are reserved but never touched.
+*/
+static int	mmap_grow(t_sink_state *st, size_t need)
+{
+	size_t	len;
+	char	*map;
+
+	if (st->map_off + (off_t)need > st->file_len)
+	{
+		if (ftruncate(st->map_fd, st->map_off + need))
+			return (1);
+		st->file_len = st->map_off + need;
+	}
+	len = st->map_len;
+	while (len < need || len == 0)
+		len += SINK_MAP_CHUNK;
+	if (len == st->map_len)
+		return (0);
+	if (!st->map)
+		map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED,
+				st->map_fd, st->map_off);
+	else
+		map = mremap(st->map, st->map_len, len, MREMAP_MAYMOVE);
+	if (map == MAP_FAILED)
+		return (1);
+	st->map = map;
+	st->map_len = len;
+	return (0);
+}
+
+/*
+** Only for a regular file on stdout: output continues at its current
+** offset, or at its end when it was opened with O_APPEND (>>), reached
+** through a page-aligned mapping. The shell opens stdout write-only,
+** which a shared writable mapping refuses, hence map_fd.
+*/
+int	mmap_open(t_logger *log)
+{
+	t_sink_state	*st;
+	struct stat		sb;
+	off_t			pos;
+	long			page;
+
+	st = &log->out;
+	pos = lseek(1, 0, SEEK_CUR);
+	page = sysconf(_SC_PAGESIZE);
+	if (fstat(1, &sb) || !S_ISREG(sb.st_mode) || pos < 0 || page <= 0)
+		return (1);
+	if (fcntl(1, F_GETFL) & O_APPEND)
+		pos = sb.st_size;
+	st->map_fd = open("/proc/self/fd/1", O_RDWR);
+	st->file_len = sb.st_size;
+	st->map_off = pos - pos % page;
+	st->base = pos - st->map_off;
+	st->map = NULL;
+	st->map_len = 0;
+	st->written = 0;
+	if (st->map_fd >= 0 && mmap_grow(st, st->base) == 0)
+		return (0);
+	mmap_close(log);
+	return (1);
+}
+
+/*
+** One flusher at a time (the logger thread, or the event engine), which
+** is also what makes moving the mapping in mmap_grow() safe. The file
+** is extended to the end of this buffer before the copy, so only a crash
+** in the middle of the memcpy can leave NULs behind. A failed grow falls
+** back to pwrite(2) at the same offset.
+*/
+void	mmap_flush(t_logger *log, int full)
+{
+	t_sink_state	*st;
+	size_t			off;
+	size_t			end;
+
+	(void)full;
+	st = &log->out;
+	if (log->len == 0)
+		return ;
+	off = st->base + st->written;
+	end = off + log->len;
+	if (mmap_grow(st, end) == 0)
+		memcpy(st->map + off, log->buf, log->len);
+	else if (pwrite(1, log->buf, log->len, st->map_off + off) < 0)
+		ft_putendl_fd("philo: mmap sink: write failed", 2);
+	st->written += log->len;
+	log->len = 0;
+}
+
+/*
+** The file already ends at the last written byte (or its size at open),
+** so closing only moves the offset there for later writes to stdout.
+*/
+void	mmap_close(t_logger *log)
+{
+	t_sink_state	*st;
+
+	st = &log->out;
+	if (st->map)
+		munmap(st->map, st->map_len);
+	st->map = NULL;
+	if (st->map_fd >= 0)
+		close(st->map_fd);
+	st->map_fd = -1;
+	lseek(1, st->map_off + st->base + st->written, SEEK_SET);
+}
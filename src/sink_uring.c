@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_uring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:17:42 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Queues one write of buf at the current file position. If the kernel
+** refuses the submission the ring is marked failed and never entered
+** again, so the queued entry cannot run late.
+*/
+static int	uring_submit(t_uring *r, char *buf, size_t len)
+{
+	struct io_uring_sqe	*sqe;
+	unsigned int		tail;
+
+	tail = atomic_load_explicit(r->sq_tail, memory_order_relaxed);
+	sqe = &r->sqes[tail & *r->sq_mask];
+	ft_bzero(sqe, sizeof(*sqe));
+	sqe->opcode = IORING_OP_WRITE;
+	sqe->fd = 1;
+	sqe->addr = (uint64_t)(uintptr_t)buf;
+	sqe->len = len;
+	sqe->off = (uint64_t)-1;
+	r->sq_array[tail & *r->sq_mask] = tail & *r->sq_mask;
+	atomic_store_explicit(r->sq_tail, tail + 1, memory_order_release);
+	if (syscall(SYS_io_uring_enter, r->fd, 1, 0, 0, NULL, 0) != 1)
+	{
+		r->failed = 1;
+		return (1);
+	}
+	r->pending = buf;
+	r->inflight = len;
+	return (0);
+}
+
+/*
+** Waits for the write in flight. A short or failed completion has the
+** rest written with write(2), so nothing is lost or reordered.
+*/
+static void	uring_reap(t_uring *r)
+{
+	unsigned int	head;
+	long			res;
+	ssize_t			ret;
+
+	if (r->inflight == 0)
+		return ;
+	head = atomic_load_explicit(r->cq_head, memory_order_relaxed);
+	while (head == atomic_load_explicit(r->cq_tail, memory_order_acquire))
+		syscall(SYS_io_uring_enter, r->fd, 0, 1, IORING_ENTER_GETEVENTS,
+			NULL, 0);
+	res = r->cqes[head & *r->cq_mask].res;
+	atomic_store_explicit(r->cq_head, head + 1, memory_order_release);
+	if (res < 0)
+		res = 0;
+	while ((size_t)res < r->inflight)
+	{
+		ret = write(1, r->pending + res, r->inflight - res);
+		if (ret <= 0)
+			break ;
+		res += ret;
+	}
+	r->inflight = 0;
+}
+
+/*
+** Hands the buffer to the kernel and formats into the spare meanwhile;
+** the previous write is reaped first, so at most one is in flight and
+** output order is kept.
+*/
+void	uring_flush(t_logger *log, int full)
+{
+	t_uring	*r;
+	char	*tmp;
+
+	r = &log->out.ring;
+	uring_reap(r);
+	if (log->len == 0)
+		return ;
+	if (r->failed || uring_submit(r, log->buf, log->len))
+	{
+		write_flush(log, full);
+		return ;
+	}
+	tmp = log->buf;
+	log->buf = r->spare;
+	r->spare = tmp;
+	log->len = 0;
+}
+
+void	uring_close(t_logger *log)
+{
+	t_uring	*r;
+
+	r = &log->out.ring;
+	if (r->fd >= 0 && !r->failed)
+		uring_reap(r);
+	if (r->sq)
+		munmap(r->sq, r->sq_len);
+	if (r->cq)
+		munmap(r->cq, r->cq_len);
+	if (r->sqes)
+		munmap(r->sqes, r->sq_entries * sizeof(struct io_uring_sqe));
+	if (r->fd >= 0)
+		close(r->fd);
+	free(r->spare);
+	r->spare = NULL;
+	r->fd = -1;
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_uring_init.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:17:42 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static void	*ring_map(int fd, size_t len, off_t what)
+{
+	void	*p;
+
+	p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			fd, what);
+	if (p == MAP_FAILED)
+		return (NULL);
+	return (p);
+}
+
+static int	ring_setup(t_uring *r, struct io_uring_params *p)
+{
+	r->sq_len = p->sq_off.array + p->sq_entries * sizeof(unsigned int);
+	r->sq_entries = p->sq_entries;
+	r->cq_len = p->cq_off.cqes + p->cq_entries * sizeof(struct io_uring_cqe);
+	r->sq = ring_map(r->fd, r->sq_len, IORING_OFF_SQ_RING);
+	r->cq = ring_map(r->fd, r->cq_len, IORING_OFF_CQ_RING);
+	r->sqes = ring_map(r->fd, p->sq_entries * sizeof(struct io_uring_sqe),
+			IORING_OFF_SQES);
+	if (!r->sq || !r->cq || !r->sqes)
+		return (1);
+	r->sq_tail = (atomic_uint *)(r->sq + p->sq_off.tail);
+	r->sq_mask = (unsigned int *)(r->sq + p->sq_off.ring_mask);
+	r->sq_array = (unsigned int *)(r->sq + p->sq_off.array);
+	r->cq_head = (atomic_uint *)(r->cq + p->cq_off.head);
+	r->cq_tail = (atomic_uint *)(r->cq + p->cq_off.tail);
+	r->cq_mask = (unsigned int *)(r->cq + p->cq_off.ring_mask);
+	r->cqes = (struct io_uring_cqe *)(r->cq + p->cq_off.cqes);
+	return (0);
+}
+
+/*
+** Two-entry ring through io_uring_setup(2) and the three mmap()s; glibc
+** has no wrapper and liburing is not a dependency. Needs a kernel that
+** writes at the current file position (IORING_FEAT_RW_CUR_POS, 5.6), so
+** writes to a pipe or terminal stay in order.
+*/
+int	uring_open(t_logger *log)
+{
+	t_uring					*r;
+	struct io_uring_params	p;
+
+	r = &log->out.ring;
+	ft_bzero(r, sizeof(t_uring));
+	ft_bzero(&p, sizeof(p));
+	r->fd = syscall(SYS_io_uring_setup, 2, &p);
+	if (r->fd < 0)
+		return (1);
+	r->spare = malloc(LOG_BUF_SIZE);
+	if (!r->spare || !(p.features & IORING_FEAT_RW_CUR_POS)
+		|| ring_setup(r, &p))
+	{
+		uring_close(log);
+		return (1);
+	}
+	return (0);
+}
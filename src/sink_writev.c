@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink_writev.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:17:12 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:20:47 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Drops the done bytes from the front of the n entries at *iov after a
+** short writev(2) and returns how many entries are left.
+*/
+static int	iov_advance(struct iovec **iov, int n, size_t done)
+{
+	while (n > 0 && done >= (*iov)->iov_len)
+	{
+		done -= (*iov)->iov_len;
+		(*iov)++;
+		n--;
+	}
+	if (n > 0)
+	{
+		(*iov)->iov_base = (char *)(*iov)->iov_base + done;
+		(*iov)->iov_len -= done;
+	}
+	return (n);
+}
+
+/*
+** Writes every parked buffer and the current one in as few writev(2)
+** calls as the kernel allows, then goes back to the first pool buffer.
+*/
+static void	writev_all(t_logger *log)
+{
+	t_sink_state	*st;
+	struct iovec	*iov;
+	int				n;
+	ssize_t			ret;
+
+	st = &log->out;
+	st->iov[st->parked].iov_base = log->buf;
+	st->iov[st->parked].iov_len = log->len;
+	iov = st->iov;
+	n = st->parked + 1;
+	while (n > 0)
+	{
+		ret = writev(1, iov, n);
+		if (ret <= 0)
+			break ;
+		n = iov_advance(&iov, n, ret);
+	}
+	st->parked = 0;
+	log->buf = st->pool[0];
+	log->len = 0;
+}
+
+int	writev_open(t_logger *log)
+{
+	t_sink_state	*st;
+	int				i;
+
+	st = &log->out;
+	st->pool[0] = log->buf;
+	st->parked = 0;
+	i = 1;
+	while (i < LOG_IOV_MAX)
+	{
+		st->pool[i] = malloc(LOG_BUF_SIZE);
+		if (!st->pool[i])
+		{
+			while (--i > 0)
+				free(st->pool[i]);
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/*
+** A buffer that ran full is parked and the next pool buffer takes over;
+** ticks, and the last free buffer, write the whole batch at once.
+*/
+void	writev_flush(t_logger *log, int full)
+{
+	t_sink_state	*st;
+
+	st = &log->out;
+	if (full && st->parked + 1 < LOG_IOV_MAX)
+	{
+		st->iov[st->parked].iov_base = log->buf;
+		st->iov[st->parked].iov_len = log->len;
+		st->parked++;
+		log->buf = st->pool[st->parked];
+		log->len = 0;
+		return ;
+	}
+	if (log->len || st->parked)
+		writev_all(log);
+}
+
+void	writev_close(t_logger *log)
+{
+	int	i;
+
+	i = 1;
+	while (i < LOG_IOV_MAX)
+		free(log->out.pool[i++]);
+	log->buf = log->out.pool[0];
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:40:50 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:49:21 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Philosophers form an implicit SPAWN_FANOUT-ary tree over their
+** indices: i creates i * SPAWN_FANOUT + 1 onwards. This counts the
+** threads of the subtree rooted at i, the ones lost if i is not created.
+*/
+static int	subtree_size(int n, int i)
+{
+	long	lo;
+	long	hi;
+	int		size;
+
+	lo = i;
+	hi = i;
+	size = 0;
+	while (lo < n)
+	{
+		if (hi > n - 1)
+			hi = n - 1;
+		size += hi - lo + 1;
+		lo = lo * SPAWN_FANOUT + 1;
+		hi = hi * SPAWN_FANOUT + SPAWN_FANOUT;
+	}
+	return (size);
+}
+
+/*
+** Creates philosopher i. On failure its whole subtree is counted in at
+** the start barrier as if it had arrived, and the barrier is marked
+** failed so start_open() ends the run before it begins.
+*/
+int	spawn_one(t_table *table, int i)
+{
+	pthread_attr_t	*attr;
+
+	attr = NULL;
+	if (table->spawn.has_attr)
+		attr = &table->spawn.attr;
+	if (pthread_create(&table->philo[i].thread, attr, philo_thread,
+			&table->philo[i]) == 0)
+		return (0);
+	atomic_store(&table->gate.failed, 1);
+	start_arrive(table, subtree_size(table->num_philos, i));
+	return (1);
+}
+
+/*
+** Run by every philosopher thread before anything else. After the first
+** failure the remaining siblings are not tried, only counted in, so the
+** children created are always the first philo->children ones.
+*/
+void	spawn_children(t_philo *philo)
+{
+	t_table	*table;
+	int		first;
+	int		failed;
+	int		k;
+
+	table = philo->table;
+	first = (philo->id - 1) * SPAWN_FANOUT + 1;
+	failed = 0;
+	k = 0;
+	while (k < SPAWN_FANOUT && first + k < table->num_philos)
+	{
+		if (failed)
+			start_arrive(table, subtree_size(table->num_philos, first + k));
+		else if (spawn_one(table, first + k))
+			failed = 1;
+		else
+			philo->children++;
+		k++;
+	}
+}
+
+/*
+** Each thread joins the children it created, so main only joins the
+** root and a failed spawn never leaves a thread behind.
+*/
+static void	spawn_join(t_philo *philo)
+{
+	int	first;
+	int	k;
+
+	first = (philo->id - 1) * SPAWN_FANOUT + 1;
+	k = 0;
+	while (k < philo->children)
+	{
+		pthread_join(philo->table->philo[first + k].thread, NULL);
+		k++;
+	}
+}
+
+/*
+** Thread entry of a philosopher under --engine=threads: create the
+** subtree, pin, wait for the epoch, run, then reap the subtree.
+*/
+void	*philo_thread(void *arg)
+{
+	t_philo	*philo;
+
+	philo = (t_philo *)arg;
+	spawn_children(philo);
+	pin_to_shard(philo->table, philo->shard);
+	start_wait(philo->table);
+	philo_routine(philo);
+	spawn_join(philo);
+	return (NULL);
+}
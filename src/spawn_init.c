@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_init.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:40:59 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:49:21 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Philosopher threads get --stack-size KiB of stack instead of the 8 MiB
+** default reservation; 0 keeps the default.
+*/
+int	spawn_init(t_table *table)
+{
+	if (!table->opt.stack_kib)
+		return (0);
+	if (pthread_attr_init(&table->spawn.attr))
+		return (1);
+	table->spawn.has_attr = 1;
+	return (pthread_attr_setstacksize(&table->spawn.attr,
+			(size_t)table->opt.stack_kib * 1024) != 0);
+}
+
+void	spawn_free(t_table *table)
+{
+	if (table->spawn.has_attr)
+		pthread_attr_destroy(&table->spawn.attr);
+	table->spawn.has_attr = 0;
+}
+
+/*
+** Samples /proc/self/statm (sizes in pages) right after the start, for
+** the per-philosopher VSZ and RSS in the --stats report.
+*/
+void	spawn_measure(t_table *table)
+{
+	char	buf[128];
+	long	page_kib;
+	ssize_t	len;
+	int		fd;
+	int		i;
+
+	fd = open("/proc/self/statm", O_RDONLY);
+	if (fd < 0)
+		return ;
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return ;
+	buf[len] = '\0';
+	page_kib = sysconf(_SC_PAGESIZE) / 1024;
+	table->spawn.vsz_kib = ft_atol(buf) * page_kib;
+	i = 0;
+	while (buf[i] && buf[i] != ' ')
+		i++;
+	table->spawn.rss_kib = ft_atol(buf + i) * page_kib;
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   start.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:36:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:45:25 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+static void	nsec_max(_Atomic t_nsec *max, t_nsec v)
+{
+	t_nsec	seen;
+
+	seen = atomic_load_explicit(max, memory_order_relaxed);
+	while (seen < v && !atomic_compare_exchange_weak_explicit(max, &seen, v,
+			memory_order_relaxed, memory_order_relaxed))
+		;
+}
+
+void	start_arrive(t_table *table, int count)
+{
+	t_start	*gate;
+
+	gate = &table->gate;
+	if (atomic_fetch_add(&gate->arrived, count) + count
+		== atomic_load(&gate->expected))
+		futex_wake(&gate->arrived, 1);
+}
+
+/*
+** Every started thread checks in here and sleeps until start_open()
+** publishes the epoch, then records how late it got going.
+*/
+void	start_wait(t_table *table)
+{
+	t_start	*gate;
+
+	gate = &table->gate;
+	start_arrive(table, 1);
+	while (!atomic_load_explicit(&gate->open, memory_order_acquire))
+		futex_wait(&gate->open, 0);
+	nsec_max(&gate->skew, now_precise() - table->start);
+}
+
+/*
+** Waits for the expected threads to check in, then takes one timestamp
+** that becomes both start and every last_meal, so the first deadline is
+** counted from the moment everybody can run, not from when the table
+** was built or its thread was created. If a thread could not be created
+** the run is ended before the gate opens, so the others exit at once;
+** returns 1 then.
+*/
+int	start_open(t_table *table, int expected)
+{
+	t_start	*gate;
+	int		arrived;
+	int		i;
+
+	gate = &table->gate;
+	atomic_store(&gate->expected, expected);
+	arrived = atomic_load(&gate->arrived);
+	while (arrived < expected)
+	{
+		futex_wait(&gate->arrived, arrived);
+		arrived = atomic_load(&gate->arrived);
+	}
+	table->start = now_precise();
+	i = 0;
+	while (i < table->num_philos)
+	{
+		atomic_store_explicit(&table->hot[i].last_meal, table->start,
+			memory_order_relaxed);
+		i++;
+	}
+	if (atomic_load(&gate->failed))
+		atomic_store(&table->simulation, 0);
+	atomic_store_explicit(&gate->open, 1, memory_order_release);
+	futex_wake(&gate->open, INT_MAX);
+	return (atomic_load(&gate->failed));
+}
+
+/*
+** How long after the epoch a philosopher makes its first move: even ids
+** give their odd neighbours a head start. Waking hundreds of threads per
+** core off the barrier takes milliseconds, so it is half a meal long
+** rather than a fixed millisecond that the wake skew alone could use up.
+** The des engine schedules its first events from here too, so both
+** engines run the same protocol.
+*/
+t_nsec	start_offset(t_table *table, int philo_id)
+{
+	if (philo_id % 2)
+		return (0);
+	return (NS_PER_MS + table->time_to_eat * NS_PER_MS / 2);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:03:34 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:03:34 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** About 6.5 KiB per philosopher, so only allocated with --stats=on.
+*/
+int	stats_init(t_table *table)
+{
+	int	i;
+
+	if (!table->opt.stats)
+		return (0);
+	table->stats.philo = cache_alloc(table->num_philos,
+			sizeof(t_philo_stats));
+	if (!table->stats.philo)
+		return (1);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		table->stats.philo[i].min_slack = INT64_MAX;
+		i++;
+	}
+	return (0);
+}
+
+void	stats_free(t_table *table)
+{
+	free(table->stats.philo);
+	table->stats.philo = NULL;
+}
+
+int	hist_bucket(t_nsec v)
+{
+	int	e;
+
+	if (v < HIST_SUB)
+		return ((int)(v * (v > 0)));
+	e = 63 - __builtin_clzll((unsigned long long)v);
+	if (e > HIST_MAX_EXP)
+		return (HIST_BUCKETS - 1);
+	return ((e - HIST_SUB_BITS + 1) * HIST_SUB
+		+ (int)((v >> (e - HIST_SUB_BITS)) & (HIST_SUB - 1)));
+}
+
+/*
+** A relaxed load and store rather than an atomic add: the histogram has
+** a single writer, so nothing can be lost and no lock prefix is paid.
+*/
+void	hist_record(t_hist *hist, t_nsec v)
+{
+	atomic_uint	*slot;
+
+	slot = &hist->count[hist_bucket(v)];
+	atomic_store_explicit(slot,
+		atomic_load_explicit(slot, memory_order_relaxed) + 1,
+		memory_order_relaxed);
+}
+
+/*
+** interval is the time since the previous meal (or since the start);
+** slack is what was left of time_to_die, negative for a late meal.
+*/
+void	stats_meal(t_philo *philo, t_table *table, t_nsec interval)
+{
+	t_philo_stats	*st;
+	t_nsec			slack;
+
+	st = &table->stats.philo[philo->id - 1];
+	slack = table->time_to_die * NS_PER_MS - interval;
+	hist_record(&st->h[STAT_INTERVAL], interval);
+	hist_record(&st->h[STAT_SLACK], slack);
+	if (slack < atomic_load_explicit(&st->min_slack, memory_order_relaxed))
+		atomic_store_explicit(&st->min_slack, slack, memory_order_relaxed);
+}
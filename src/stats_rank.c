@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_rank.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:03:34 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:03:34 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Jain's fairness index of the meal counts, (sum x)^2 / (n * sum x^2):
+** 1 when everybody ate equally often, 1/n when one philosopher ate alone.
+*/
+double	stats_jain(t_table *table)
+{
+	double	sum;
+	double	sq;
+	double	x;
+	int		i;
+
+	sum = 0;
+	sq = 0;
+	i = 0;
+	while (i < table->num_philos)
+	{
+		x = atomic_load_explicit(&table->hot[i].meals_eaten,
+				memory_order_relaxed);
+		sum += x;
+		sq += x * x;
+		i++;
+	}
+	if (sq == 0)
+		return (1.0);
+	return (sum * sum / (table->num_philos * sq));
+}
+
+static t_nsec	min_slack(t_table *table, int i)
+{
+	return (atomic_load_explicit(&table->stats.philo[i].min_slack,
+			memory_order_relaxed));
+}
+
+/* Whether philosopher i comes after prev in (slack, id) order */
+static int	ranks_after(t_table *table, int i, int prev)
+{
+	if (min_slack(table, i) == INT64_MAX)
+		return (0);
+	if (prev < 0)
+		return (1);
+	if (min_slack(table, i) != min_slack(table, prev))
+		return (min_slack(table, i) > min_slack(table, prev));
+	return (i > prev);
+}
+
+/*
+** Lists the count philosophers with the smallest slack by repeated scans,
+** each picking the first one after the previous pick; count is small, so
+** this beats sorting every philosopher.
+*/
+void	stats_worst(t_table *table, int count)
+{
+	int	prev;
+	int	best;
+	int	i;
+
+	prev = -1;
+	dprintf(2, "worst slack");
+	while (count > 0)
+	{
+		best = -1;
+		i = 0;
+		while (i < table->num_philos)
+		{
+			if (ranks_after(table, i, prev) && (best < 0
+					|| min_slack(table, i) < min_slack(table, best)))
+				best = i;
+			i++;
+		}
+		if (best < 0)
+			break ;
+		dprintf(2, "  %d (%.3f ms)", best + 1,
+			(double)min_slack(table, best) / NS_PER_MS);
+		prev = best;
+		count--;
+	}
+	dprintf(2, "\n");
+}
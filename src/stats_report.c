@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:03:34 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:49:21 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/* Midpoint of the values that fall in bucket b */
+static t_nsec	hist_value(int b)
+{
+	int	shift;
+
+	if (b < HIST_SUB)
+		return (b);
+	shift = b / HIST_SUB - 1;
+	return (((t_nsec)(HIST_SUB + b % HIST_SUB) << shift)
+		+ ((t_nsec)1 << shift) / 2);
+}
+
+/*
+** Sums one histogram over every philosopher. The writers keep running,
+** so a bucket may miss a sample that lands meanwhile, never more.
+*/
+static unsigned long	hist_merge(t_table *table, t_stat stat,
+	unsigned long *sum)
+{
+	unsigned long	total;
+	int				i;
+	int				b;
+
+	total = 0;
+	ft_bzero(sum, sizeof(unsigned long) * HIST_BUCKETS);
+	i = 0;
+	while (i < table->num_philos)
+	{
+		b = 0;
+		while (b < HIST_BUCKETS)
+		{
+			sum[b] += atomic_load_explicit(
+					&table->stats.philo[i].h[stat].count[b],
+					memory_order_relaxed);
+			b++;
+		}
+		i++;
+	}
+	b = 0;
+	while (b < HIST_BUCKETS)
+		total += sum[b++];
+	return (total);
+}
+
+static double	percentile(unsigned long *sum, unsigned long total, double q)
+{
+	unsigned long	rank;
+	unsigned long	seen;
+	int				b;
+
+	rank = (unsigned long)(q * (total - 1)) + 1;
+	seen = 0;
+	b = 0;
+	while (b < HIST_BUCKETS - 1)
+	{
+		seen += sum[b];
+		if (seen >= rank)
+			break ;
+		b++;
+	}
+	return ((double)hist_value(b) / NS_PER_MS);
+}
+
+static void	print_stat(t_table *table, t_stat stat, const char *name)
+{
+	unsigned long	sum[HIST_BUCKETS];
+	unsigned long	total;
+
+	total = hist_merge(table, stat, sum);
+	if (!total)
+		return ;
+	dprintf(2, "%-10s %8lu  p50 %9.3f  p99 %9.3f  max %9.3f\n", name,
+		total, percentile(sum, total, 0.5), percentile(sum, total, 0.99),
+		percentile(sum, total, 1.0));
+}
+
+/*
+** The start skew is measured on every run but only printed here.
+** Negative slack lands in bucket 0, so the slack line is a floor; the
+** exact minimum of each philosopher is listed by stats_worst().
+*/
+void	stats_report(t_table *table)
+{
+	if (!table->stats.philo)
+		return ;
+	dprintf(2, "philo: stats for %d philosophers (samples, then ms)\n",
+		table->num_philos);
+	dprintf(2, "spawn      %9.3f  vsz %ld KiB  rss %ld KiB per philosopher\n",
+		(double)table->spawn.ns / NS_PER_MS,
+		table->spawn.vsz_kib / table->num_philos,
+		table->spawn.rss_kib / table->num_philos);
+	dprintf(2, "start skew %9.3f  (epoch to the last thread running)\n",
+		(double)atomic_load(&table->gate.skew) / NS_PER_MS);
+	print_stat(table, STAT_WAIT, "fork wait");
+	print_stat(table, STAT_INTERVAL, "meal gap");
+	print_stat(table, STAT_SLACK, "slack");
+	dprintf(2, "fairness   Jain's index over meals %.4f (1 = even)\n",
+		stats_jain(table));
+	stats_worst(table, STATS_WORST);
+}
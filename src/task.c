@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:33:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 05:41:24 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+void	task_entry(t_task *task)
+{
+	philo_routine(task->philo);
+	task_switch(task, PARK_EXIT);
+}
+
+/*
+** Saves the task and resumes its worker's scheduler, which acts on park.
+** Returns once a worker, not necessarily the same one, resumes the task.
+*/
+void	task_switch(t_task *task, t_park park)
+{
+	task->park = park;
+	task_ctx_switch(&task->ctx, &task->worker->sched);
+}
+
+/*
+** Returns at once after the run has ended, so no task parks on a timer
+** that pool_stop() has already flushed.
+*/
+void	task_sleep(t_task *task, t_nsec deadline)
+{
+	if (!atomic_load_explicit(&task->philo->table->simulation,
+			memory_order_acquire))
+		return ;
+	task->wake = deadline;
+	task_switch(task, PARK_TIMER);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_ctx.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:39:34 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:42:18 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+#if defined(__x86_64__)
+
+/*
+** Hand-rolled switch: push the callee-saved registers, swap stack
+** pointers, pop. swapcontext() also saves and restores the signal mask
+** with a system call on every switch, about 0.7us a round trip here,
+** which is most of a task's budget at 100k philosophers on few cores.
+** A new stack is laid out as if task_ctx_boot had been switched away
+** from with the task in r12; boot passes it on to task_entry().
+*/
+__asm__(
+	".text\n"
+	".globl task_ctx_switch\n"
+	".type task_ctx_switch, @function\n"
+	"task_ctx_switch:\n"
+	"	pushq %rbp\n"
+	"	pushq %rbx\n"
+	"	pushq %r12\n"
+	"	pushq %r13\n"
+	"	pushq %r14\n"
+	"	pushq %r15\n"
+	"	movq %rsp, (%rdi)\n"
+	"	movq (%rsi), %rsp\n"
+	"	popq %r15\n"
+	"	popq %r14\n"
+	"	popq %r13\n"
+	"	popq %r12\n"
+	"	popq %rbx\n"
+	"	popq %rbp\n"
+	"	ret\n"
+	".size task_ctx_switch, .-task_ctx_switch\n"
+	"task_ctx_boot:\n"
+	"	movq %r12, %rdi\n"
+	"	call task_entry\n"
+	"	ud2\n");
+
+void	task_ctx_boot(void);
+
+/*
+** Seven words below the 16-byte aligned top: r15..r12, rbx, rbp and the
+** return address. After the final ret the stack is aligned again, as a
+** call site expects.
+*/
+void	task_ctx_init(t_task *task, char *stack)
+{
+	void	**sp;
+
+	sp = (void **)((uintptr_t)(stack + TASK_STACK_SIZE) & ~(uintptr_t)15);
+	sp -= 7;
+	ft_memset(sp, 0, sizeof(void *) * 6);
+	sp[3] = task;
+	sp[6] = (void *)task_ctx_boot;
+	task->ctx = sp;
+	task->started = 1;
+}
+
+#else
+
+/*
+** makecontext() only passes int arguments, so the task pointer arrives
+** split in two halves.
+*/
+static void	task_ctx_boot(unsigned int hi, unsigned int lo)
+{
+	task_entry((t_task *)(((uintptr_t)hi << 32) | lo));
+}
+
+void	task_ctx_init(t_task *task, char *stack)
+{
+	uintptr_t	addr;
+
+	getcontext(&task->ctx);
+	task->ctx.uc_stack.ss_sp = stack;
+	task->ctx.uc_stack.ss_size = TASK_STACK_SIZE;
+	task->ctx.uc_link = NULL;
+	addr = (uintptr_t)task;
+	makecontext(&task->ctx, (void (*)(void))task_ctx_boot, 2,
+		(unsigned int)(addr >> 32), (unsigned int)addr);
+	task->started = 1;
+}
+
+void	task_ctx_switch(t_task_ctx *save, t_task_ctx *load)
+{
+	swapcontext(save, load);
+}
+
+#endif
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_fork.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:33:51 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:42:18 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+void	task_fork_take(t_task *task, t_task_fork *fork)
+{
+	int	expected;
+
+	expected = 0;
+	if (atomic_compare_exchange_strong(&fork->state, &expected, 1))
+		return ;
+	task->want = fork;
+	task_switch(task, PARK_FORK);
+}
+
+/*
+** Runs on the worker once the task is saved: the waiter is published
+** first, then state goes 1 -> 2. If the holder let go in between, the
+** fork is taken here and the task goes straight back to the queue.
+*/
+void	task_fork_park(t_worker *worker, t_task *task)
+{
+	t_task_fork	*fork;
+	int			expected;
+
+	fork = task->want;
+	fork->waiter = task;
+	while (1)
+	{
+		expected = 1;
+		if (atomic_compare_exchange_strong(&fork->state, &expected, 2))
+			return ;
+		expected = 0;
+		if (atomic_compare_exchange_strong(&fork->state, &expected, 1))
+		{
+			pool_ready(worker, task);
+			return ;
+		}
+	}
+}
+
+/*
+** Only the two neighbours ever touch a fork, so with a waiter parked the
+** releaser is the only other party and can hand ownership over directly.
+*/
+void	task_fork_drop(t_task *task, t_task_fork *fork)
+{
+	t_task	*waiter;
+	int		expected;
+
+	expected = 1;
+	if (atomic_compare_exchange_strong(&fork->state, &expected, 0))
+		return ;
+	waiter = fork->waiter;
+	atomic_store(&fork->state, 1);
+	pool_ready(task->worker, waiter);
+}
+
+void	task_take_forks(t_philo *philo, t_table *table)
+{
+	t_task		*task;
+	t_task_fork	*first;
+	t_task_fork	*second;
+
+	task = &table->pool->tasks[philo->id - 1];
+	first = &table->pool->forks[philo->id - 1];
+	second = &table->pool->forks[philo->id % table->num_philos];
+	if (philo->id % 2 == 0)
+	{
+		first = second;
+		second = &table->pool->forks[philo->id - 1];
+	}
+	task_fork_take(task, first);
+	print_status(table, philo->id, ST_FORK);
+	task_fork_take(task, second);
+	print_status(table, philo->id, ST_FORK);
+}
+
+void	task_drop_forks(t_philo *philo, t_table *table)
+{
+	t_task	*task;
+
+	task = &table->pool->tasks[philo->id - 1];
+	task_fork_drop(task, &table->pool->forks[philo->id - 1]);
+	task_fork_drop(task, &table->pool->forks[philo->id % table->num_philos]);
+}
@@ -6,39 +6,64 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:30:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/06 14:47:53 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:35:36 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
-long	get_time_ms(void)
+t_nsec	*sleep_tail(void)
 {
-	struct timeval	time;
-	int				ms_time;
+	static t_nsec	tail = SLEEP_TAIL_US * NS_PER_US;
 
-	gettimeofday(&time, NULL);
-	ms_time = (time.tv_sec * 1000) + (time.tv_usec / 1000);
-	return (ms_time);
+	return (&tail);
 }
 
-long	get_elapsed_time_ms(long s_time)
+void	sleep_set_tail(long usecs)
 {
-	return (get_time_ms() - s_time);
+	*sleep_tail() = usecs * NS_PER_US;
 }
 
-int	ft_usleep(long msecs)
+/*
+** Coarse part of an interruptible sleep: a futex wait on the stop word
+** with the same absolute deadline, so a wake-all returns at once.
+*/
+static void	sleep_on(atomic_int *stop, t_nsec coarse)
+{
+	while (atomic_load_explicit(stop, memory_order_acquire)
+		&& now_precise() < coarse)
+		futex_wait_until(stop, 1, coarse);
+}
+
+/*
+** Hybrid sleep: one absolute clock_nanosleep() covers everything but the
+** last tail, which is finished by yielding until the deadline, so timer
+** slack and wakeup latency never push us past it. With a stop word the
+** sleep also ends as soon as it drops to 0.
+*/
+void	sleep_until(t_nsec deadline, atomic_int *stop)
 {
-	long	start;
-	long	curr;
+	t_nsec			coarse;
+	struct timespec	ts;
 
-	start = get_time_ms();
-	while (1)
+	coarse = deadline - *sleep_tail();
+	if (stop)
+		sleep_on(stop, coarse);
+	else if (now_precise() < coarse)
 	{
-		curr = get_time_ms();
-		if ((curr - start) >= msecs)
-			break ;
-		usleep(100);
+		ts.tv_sec = coarse / NS_PER_SEC;
+		ts.tv_nsec = coarse % NS_PER_SEC;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)
+			== EINTR)
+			;
 	}
+	while (now_precise() < deadline
+		&& (!stop || atomic_load_explicit(stop, memory_order_relaxed)))
+		sched_yield();
+}
+
+int	ft_usleep(long msecs)
+{
+	sleep_until(now_precise() + msecs * NS_PER_MS, NULL);
 	return (0);
 }
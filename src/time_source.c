@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_source.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:16:01 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+t_clock	*clock_state(void)
+{
+	static t_clock	clk;
+
+	return (&clk);
+}
+
+static int	tsc_calibrate(t_clock *clk)
+{
+	struct timespec	pause;
+	t_nsec			end_ns;
+	uint64_t		end_tsc;
+
+	clk->base_ns = clock_read(CLK_MONO);
+	clk->base_tsc = tsc_read();
+	pause.tv_sec = 0;
+	pause.tv_nsec = TSC_CALIBRATION_MS * NS_PER_MS;
+	nanosleep(&pause, NULL);
+	end_ns = clock_read(CLK_MONO);
+	end_tsc = tsc_read();
+	if (end_tsc <= clk->base_tsc)
+		return (1);
+	clk->ns_per_tick = (double)(end_ns - clk->base_ns)
+		/ (double)(end_tsc - clk->base_tsc);
+	return (0);
+}
+
+/*
+** Selects the source used by now_ns(). The TSC is calibrated once against
+** CLOCK_MONOTONIC; when it is not invariant we fall back to CLOCK_MONOTONIC.
+*/
+int	clock_setup(t_clock_src src)
+{
+	t_clock	*clk;
+
+	clk = clock_state();
+	clk->src = src;
+	if (src != CLK_TSC)
+		return (0);
+	if (tsc_supported() && tsc_calibrate(clk) == 0)
+		return (0);
+	clk->src = CLK_MONO;
+	ft_putendl_fd("philo: invariant TSC unavailable, using CLOCK_MONOTONIC",
+		2);
+	return (1);
+}
+
+t_nsec	clock_read(t_clock_src src)
+{
+	struct timespec	ts;
+	t_clock			*clk;
+
+	if (src == CLK_TSC)
+	{
+		clk = clock_state();
+		return (clk->base_ns + (t_nsec)((double)(tsc_read() - clk->base_tsc)
+			* clk->ns_per_tick));
+	}
+	if (src == CLK_COARSE)
+		clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+	else
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((t_nsec)ts.tv_sec * NS_PER_SEC + ts.tv_nsec);
+}
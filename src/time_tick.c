@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_tick.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:21:37 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:24:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** Publishes the clock on an absolute schedule, so a late wakeup does not
+** shift every later tick.
+*/
+static void	*tick_routine(void *arg)
+{
+	t_clock			*clk;
+	t_nsec			next;
+	t_nsec			now;
+	struct timespec	ts;
+
+	clk = (t_clock *)arg;
+	next = clock_read(clk->src);
+	while (atomic_load_explicit(&clk->tick.running, memory_order_relaxed))
+	{
+		now = clock_read(clk->src);
+		atomic_store_explicit(&clk->tick.now, now, memory_order_relaxed);
+		next += clk->tick.tick_ns;
+		if (next <= now)
+			next = now + clk->tick.tick_ns;
+		ts.tv_sec = next / NS_PER_SEC;
+		ts.tv_nsec = next % NS_PER_SEC;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+	}
+	return (NULL);
+}
+
+/*
+** Starts the service for --clock-tick; until clock_tick_stop() now_ns()
+** returns the last published value, at most one tick (plus wakeup
+** latency) behind. The TSC source is mapped onto CLOCK_MONOTONIC, so
+** sleeping on that clock lines the ticks up with the readings.
+*/
+int	clock_tick_start(long tick_us)
+{
+	t_clock	*clk;
+
+	clk = clock_state();
+	if (tick_us <= 0)
+		return (0);
+	clk->tick.tick_ns = tick_us * NS_PER_US;
+	atomic_store(&clk->tick.now, clock_read(clk->src));
+	atomic_store(&clk->tick.running, 1);
+	if (pthread_create(&clk->tick.thread, NULL, tick_routine, clk))
+	{
+		atomic_store(&clk->tick.running, 0);
+		return (1);
+	}
+	return (0);
+}
+
+void	clock_tick_stop(void)
+{
+	t_clock	*clk;
+
+	clk = clock_state();
+	if (!atomic_load(&clk->tick.running))
+		return ;
+	atomic_store(&clk->tick.running, 0);
+	pthread_join(clk->tick.thread, NULL);
+}
+
+/*
+** The hot-path clock: one relaxed load while the service runs.
+*/
+t_nsec	now_ns(void)
+{
+	t_clock	*clk;
+
+	clk = clock_state();
+	if (atomic_load_explicit(&clk->tick.running, memory_order_relaxed))
+		return (atomic_load_explicit(&clk->tick.now, memory_order_relaxed));
+	return (clock_read(clk->src));
+}
+
+/*
+** Always reads the clock itself, for the places where one tick of lag
+** matters: sleep deadlines, last_meal and the death check.
+*/
+t_nsec	now_precise(void)
+{
+	return (clock_read(clock_state()->src));
+}
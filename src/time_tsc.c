@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_tsc.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:16:01 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 03:16:01 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <cpuid.h>
+# include <x86intrin.h>
+
+/*
+** Only an invariant TSC (CPUID 0x80000007, EDX bit 8) ticks at a constant
+** rate across P-states and sleep states, so anything else is refused.
+*/
+int	tsc_supported(void)
+{
+	unsigned int	eax;
+	unsigned int	ebx;
+	unsigned int	ecx;
+	unsigned int	edx;
+
+	if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+		return (0);
+	return ((edx >> 8) & 1);
+}
+
+uint64_t	tsc_read(void)
+{
+	return (__rdtsc());
+}
+
+#else
+
+int	tsc_supported(void)
+{
+	return (0);
+}
+
+uint64_t	tsc_read(void)
+{
+	return (0);
+}
+
+#endif
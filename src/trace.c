@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:05:45 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:05:45 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/*
+** --trace=binary output. A 24-byte header:
+**   "PHTRACE1" | u32 version | u32 record size | u32 num_philos
+**   | i32 meals_required
+** then one 8-byte record per event:
+**   u32 microseconds since the previous record | u32 id << 3 | state
+** all little-endian. A gap too long for 32 bits is bridged with
+** TRACE_ADVANCE records, which carry time and no event. tools/philo_trace
+** turns the file back into the text log.
+*/
+static void	put_le(char *dst, uint64_t v, int bytes)
+{
+	int	i;
+
+	i = 0;
+	while (i < bytes)
+	{
+		dst[i] = (char)(v >> (8 * i));
+		i++;
+	}
+}
+
+static void	put_record(t_logger *log, uint32_t delta, uint32_t word)
+{
+	put_le(log->buf + log->len, delta, 4);
+	put_le(log->buf + log->len + 4, word, 4);
+	log->len += TRACE_RECORD_SIZE;
+}
+
+/*
+** Queues the header in the writer's buffer before the first event.
+*/
+void	trace_begin(t_table *table)
+{
+	t_logger	*log;
+
+	log = &table->log;
+	log->trace_us = 0;
+	if (table->opt.trace != TRACE_BINARY)
+		return ;
+	ft_memcpy(log->buf + log->len, TRACE_MAGIC, 8);
+	put_le(log->buf + log->len + 8, TRACE_VERSION, 4);
+	put_le(log->buf + log->len + 12, TRACE_RECORD_SIZE, 4);
+	put_le(log->buf + log->len + 16, (uint32_t)table->num_philos, 4);
+	put_le(log->buf + log->len + 20, (uint32_t)table->meals_required, 4);
+	log->len += TRACE_HEADER_SIZE;
+}
+
+/*
+** Events reach the writer sorted by time, so deltas are never negative.
+*/
+void	trace_event(t_table *table, t_event *ev)
+{
+	t_logger	*log;
+	int64_t		us;
+	int64_t		delta;
+
+	log = &table->log;
+	us = (ev->ts - table->start) / NS_PER_US;
+	delta = us - log->trace_us;
+	if (delta < 0)
+		delta = 0;
+	while (delta > UINT32_MAX)
+	{
+		put_record(log, UINT32_MAX, TRACE_ADVANCE);
+		delta -= UINT32_MAX;
+	}
+	put_record(log, (uint32_t)delta,
+		((uint32_t)ev->id << TRACE_STATE_BITS) | ev->state);
+	log->trace_us += delta;
+}
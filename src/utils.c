@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/30 07:30:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/14 18:24:33 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 05:11:02 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,14 +20,40 @@ int	parser(int ac, char **av, t_table *table)
 	table->time_to_die = ft_atoi(av[2]);
 	table->time_to_eat = ft_atoi(av[3]);
 	table->time_to_sleep = ft_atoi(av[4]);
+	table->die_ns = (table->time_to_die + 1) * NS_PER_MS;
 	if (ac == 6)
 		table->meals_required = ft_atoi(av[5]);
 	else
 		table->meals_required = -1;
-	table->start = get_time_ms();
+	table->start = now_precise();
 	return (0);
 }
 
+/*
+** Sizes the arena from the philosopher count before parsing into it;
+** the event engine keeps no per-philosopher state there.
+*/
+t_table	*table_alloc(char **av, t_options *opt)
+{
+	if (opt->engine == ENGINE_DES)
+		return (arena_alloc(0, opt->hugepages));
+	return (arena_alloc(ft_atoi(av[1]), opt->hugepages));
+}
+
+/*
+** Zeroed array of n elements starting on a cache line. size must be a
+** multiple of CACHE_LINE, which holds for every type aligned to it.
+*/
+void	*cache_alloc(size_t n, size_t size)
+{
+	void	*mem;
+
+	mem = aligned_alloc(CACHE_LINE, n * size);
+	if (mem)
+		ft_bzero(mem, n * size);
+	return (mem);
+}
+
 static int	init_philo(t_table *table)
 {
 	int	i;
@@ -36,37 +62,45 @@ static int	init_philo(t_table *table)
 	while (i < table->num_philos)
 	{
 		table->philo[i].id = i + 1;
-		table->philo[i].fork_left = &table->forks[i];
-		table->philo[i].fork_right = &table->forks[(i + 1) % table->num_philos];
-		table->philo[i].last_meal = table->start;
-		table->philo[i].meals_eaten = 0;
+		table->philo[i].fork_left = &table->forks[i].lock;
+		table->philo[i].fork_right
+			= &table->forks[(i + 1) % table->num_philos].lock;
+		table->philo[i].hot = &table->hot[i];
+		table->philo[i].hunger = &table->hunger[i];
+		table->hot[i].meals_eaten = 0;
 		table->philo[i].table = table;
 		i++;
 	}
 	return (0);
 }
 
+/*
+** forks, hot and philo were carved out of the table's arena already:
+** forks and the per-meal state get a cache line each, the t_philo array
+** stays packed. Its only later writes are thread and children, made by
+** the spawn tree before the start barrier opens, so the run itself only
+** reads it.
+*/
 int	init_table(t_table *table)
 {
 	int	i;
 
-	table->forks = malloc(sizeof(pthread_mutex_t) * table->num_philos);
 	if (!table->forks)
 		return (1);
-	table->philo = malloc(sizeof(t_philo) * table->num_philos);
-	if (!table->philo)
-	{
-		free(table->forks);
-		return (1);
-	}
 	i = 0;
 	while (i < table->num_philos)
 	{
-		pthread_mutex_init(&table->forks[i], NULL);
+		if (pthread_mutex_init(&table->forks[i].lock, NULL))
+			return (1);
 		i++;
+		table->forks_ready = i;
 	}
-	pthread_mutex_init(&table->print_mutex, NULL);
-	pthread_mutex_init(&table->data_mutex, NULL);
 	init_philo(table);
-	return (0);
+	if (monitors_init(table) || stats_init(table) || flight_init(table)
+		|| spawn_init(table))
+		return (1);
+	table->strategy = strategy_of(table->opt.forks);
+	if (table->strategy->init && table->strategy->init(table))
+		return (1);
+	return (logger_init(table));
 }
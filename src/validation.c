@@ -6,7 +6,7 @@
 /*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/14 00:00:00 by ccavalca          #+#    #+#             */
-/*   Updated: 2026/01/14 00:00:00 by ccavalca         ###   ########.fr       */
+/*   Updated: 2026/10/18 04:13:01 by ccavalca         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,8 @@ static int	validate_arg_count(int ac)
 {
 	if (ac != 5 && ac != 6)
 	{
-		printf("Error: Invalid number of arguments\n");
-		printf("Usage: ./philo <num> <die> <eat> <sleep> [must_eat]\n");
+		ft_printf("Error: Invalid number of arguments\n");
+		ft_printf("Usage: ./philo <num> <die> <eat> <sleep> [must_eat]\n");
 		return (1);
 	}
 	return (0);
@@ -29,7 +29,7 @@ static int	validate_single_arg(char *arg, int pos)
 
 	if (!arg || arg[0] == '\0')
 	{
-		printf("Error: Invalid argument at position %d\n", pos);
+		ft_printf("Error: Invalid argument at position %d\n", pos);
 		return (1);
 	}
 	j = 0;
@@ -37,14 +37,14 @@ static int	validate_single_arg(char *arg, int pos)
 	{
 		if (arg[j] < '0' || arg[j] > '9')
 		{
-			printf("Error: Invalid argument at position %d\n", pos);
+			ft_printf("Error: Invalid argument at position %d\n", pos);
 			return (1);
 		}
 		j++;
 	}
 	if (ft_atoi(arg) <= 0)
 	{
-		printf("Error: Invalid argument at position %d\n", pos);
+		ft_printf("Error: Invalid argument at position %d\n", pos);
 		return (1);
 	}
 	return (0);
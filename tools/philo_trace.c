@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:06:10 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:06:10 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Decodes a --trace=binary file back into the text log, byte for byte,
+** optionally keeping one philosopher or a time window.
+** usage: tools/philo_trace [--philo=ID] [--from=MS] [--to=MS] [file]
+** Reads stdin when no file is given.
+*/
+
+#include "philo_trace.h"
+
+static uint64_t	get_le(const unsigned char *p, int bytes)
+{
+	uint64_t	v;
+
+	v = 0;
+	while (bytes-- > 0)
+		v = (v << 8) | p[bytes];
+	return (v);
+}
+
+/*
+** Returns the trace to read, stdin when no file is named, NULL on error.
+*/
+static FILE	*parse_args(int ac, char **av, t_trace_filter *f)
+{
+	FILE	*in;
+	char	*path;
+	int		i;
+
+	path = NULL;
+	memset(f, 0, sizeof(*f));
+	f->to = LONG_MAX;
+	i = 0;
+	while (++i < ac)
+	{
+		if (strncmp(av[i], "--philo=", 8) == 0)
+			f->philo = atol(av[i] + 8);
+		else if (strncmp(av[i], "--from=", 7) == 0)
+			f->from = atol(av[i] + 7);
+		else if (strncmp(av[i], "--to=", 5) == 0)
+			f->to = atol(av[i] + 5);
+		else
+			path = av[i];
+	}
+	if (!path)
+		return (stdin);
+	in = fopen(path, "rb");
+	if (!in)
+		perror(path);
+	return (in);
+}
+
+static int	read_header(FILE *in, t_trace_filter *f)
+{
+	unsigned char	h[TRACE_HEADER_SIZE];
+
+	if (fread(h, 1, TRACE_HEADER_SIZE, in) != TRACE_HEADER_SIZE
+		|| memcmp(h, TRACE_MAGIC, 8) != 0
+		|| get_le(h + 8, 4) != TRACE_VERSION
+		|| get_le(h + 12, 4) != TRACE_RECORD_SIZE)
+	{
+		fprintf(stderr, "philo_trace: not a version %d trace\n",
+			TRACE_VERSION);
+		return (1);
+	}
+	f->meals = (int)(int32_t)get_le(h + 20, 4);
+	return (0);
+}
+
+static void	print_event(t_trace_filter *f, long ms, long id, int state)
+{
+	static const char	*names[] = {"has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died"};
+
+	if (ms < f->from || ms > f->to || state == TRACE_ADVANCE
+		|| (f->philo && id != f->philo))
+		return ;
+	if (state == ST_ALL_ATE)
+		printf("%ld All philosophers have eaten %d times\n", ms, f->meals);
+	else if (state < ST_ALL_ATE)
+		printf("%ld %ld %s\n", ms, id, names[state]);
+}
+
+int	main(int ac, char **av)
+{
+	t_trace_filter	f;
+	unsigned char	rec[TRACE_RECORD_SIZE];
+	uint64_t		us;
+	uint32_t		word;
+	FILE			*in;
+
+	in = parse_args(ac, av, &f);
+	if (!in || read_header(in, &f))
+		return (1);
+	us = 0;
+	while (fread(rec, 1, TRACE_RECORD_SIZE, in) == TRACE_RECORD_SIZE)
+	{
+		us += get_le(rec, 4);
+		word = (uint32_t)get_le(rec + 4, 4);
+		print_event(&f, (long)(us / 1000), word >> TRACE_STATE_BITS,
+			word & ((1 << TRACE_STATE_BITS) - 1));
+	}
+	return (0);
+}
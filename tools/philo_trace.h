@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_trace.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ccavalca <ccavalca@student.42sp.org.br>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:06:02 by ccavalca          #+#    #+#             */
+/*   Updated: 2026/10/18 04:06:02 by ccavalca         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TRACE_H
+# define PHILO_TRACE_H
+
+# include "philosophers.h"
+
+/*
+** Which events the decoder prints: philo is 0 for everybody, from and to
+** bound the timestamp in milliseconds, both inclusive.
+*/
+typedef struct s_trace_filter
+{
+	long	philo;
+	long	from;
+	long	to;
+	int		meals;
+}	t_trace_filter;
+
+#endif